@@ -132,7 +132,7 @@ function(add_opp_run name)
 endfunction()
 
 function(add_opp_test name)
-    set(one_value_args "CONFIG;RUN;SIMTIME_LIMIT;SUFFIX")
+    set(one_value_args "CONFIG;RUN;SIMTIME_LIMIT;SUFFIX;SUMO_STATE")
     set(multi_value_args "")
     cmake_parse_arguments(args "" "${one_value_args}" "${multi_value_args}" ${ARGN})
 
@@ -170,6 +170,11 @@ function(add_opp_test name)
     add_test(NAME "${name}-${suffix}"
         COMMAND ${exec} ${config} ${opp_run_args}
         WORKING_DIRECTORY ${working_directory})
+
+    # state snapshot of add_sumo_state(<name> ...) is generated before test
+    if(args_SUMO_STATE)
+        set_tests_properties("${name}-${suffix}" PROPERTIES FIXTURES_REQUIRED sumo_state_${args_SUMO_STATE})
+    endif()
 endfunction(add_opp_test)
 
 function(generate_run_config)
@@ -0,0 +1,47 @@
+include(CMakeParseArguments)
+
+find_program(SUMO_COMMAND sumo DOC "SUMO executable used for generating state snapshots")
+find_package(PythonInterp 3 QUIET)
+mark_as_advanced(SUMO_COMMAND)
+
+set(SUMO_STATE_SCRIPT ${CMAKE_CURRENT_LIST_DIR}/../tools/sumo_state.py)
+
+# add_sumo_state(<name> SUMOCFG <file> TIME <seconds> [SEED <seed>] [OUTPUT <file>])
+# creates target sumo_state_<name> saving SUMO's state at the given time for launchers' loadState parameter
+# and test fixture sumo_state_<name> for tests loading this state, see add_opp_test(... SUMO_STATE <name>)
+function(add_sumo_state name)
+    set(one_value_args "SUMOCFG;TIME;SEED;OUTPUT")
+    cmake_parse_arguments(args "" "${one_value_args}" "" ${ARGN})
+
+    if(args_UNPARSED_ARGUMENTS)
+        message(SEND_ERROR "add_sumo_state called with invalid arguments: ${args_UNPARSED_ARGUMENTS}")
+    endif()
+
+    if(NOT args_SUMOCFG OR NOT args_TIME)
+        message(SEND_ERROR "add_sumo_state requires SUMOCFG and TIME arguments")
+    endif()
+
+    if(NOT SUMO_COMMAND OR NOT PYTHONINTERP_FOUND)
+        message(STATUS "Skip SUMO state target ${name}: SUMO or Python 3 is missing")
+        return()
+    endif()
+
+    get_filename_component(sumocfg "${args_SUMOCFG}" ABSOLUTE)
+    set(options --sumo ${SUMO_COMMAND} --sumocfg ${sumocfg} --time ${args_TIME})
+    if(args_SEED)
+        list(APPEND options --seed ${args_SEED})
+    endif()
+    if(args_OUTPUT)
+        get_filename_component(output "${args_OUTPUT}" ABSOLUTE)
+        list(APPEND options --output ${output})
+    endif()
+
+    # snapshot is only regenerated by script if it is outdated
+    add_custom_target(sumo_state_${name}
+        COMMAND ${PYTHON_EXECUTABLE} ${SUMO_STATE_SCRIPT} ${options}
+        COMMENT "Generating SUMO state snapshot ${name}"
+        VERBATIM)
+
+    add_test(NAME sumo-state-${name} COMMAND ${PYTHON_EXECUTABLE} ${SUMO_STATE_SCRIPT} ${options})
+    set_tests_properties(sumo-state-${name} PROPERTIES FIXTURES_SETUP sumo_state_${name})
+endfunction()
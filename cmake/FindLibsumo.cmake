@@ -0,0 +1,15 @@
+find_path(LIBSUMO_INCLUDE_DIR NAMES libsumo/Simulation.h HINTS ENV SUMO_HOME PATH_SUFFIXES include src DOC "libsumo include directory")
+find_library(LIBSUMO_LIBRARY NAMES sumocpp libsumocpp HINTS ENV SUMO_HOME PATH_SUFFIXES lib bin DOC "libsumo C++ library")
+mark_as_advanced(LIBSUMO_INCLUDE_DIR LIBSUMO_LIBRARY)
+
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Libsumo
+    FOUND_VAR LIBSUMO_FOUND
+    REQUIRED_VARS LIBSUMO_INCLUDE_DIR LIBSUMO_LIBRARY)
+
+if(LIBSUMO_FOUND AND NOT TARGET Libsumo::Libsumo)
+    add_library(Libsumo::Libsumo SHARED IMPORTED)
+    set_target_properties(Libsumo::Libsumo PROPERTIES
+        IMPORTED_LOCATION ${LIBSUMO_LIBRARY}
+        INTERFACE_INCLUDE_DIRECTORIES ${LIBSUMO_INCLUDE_DIR})
+endif()
@@ -16,6 +16,11 @@
 #include "artery/utility/InitStages.h"
 #include "artery/utility/FilterRules.h"
 #include "inet/common/ModuleAccess.h"
+#include <omnetpp/cconfiguration.h>
+#include <boost/optional/optional.hpp>
+#include <map>
+#include <string>
+#include <vector>
 
 using namespace omnetpp;
 
@@ -44,6 +49,86 @@ ChannelNumber getChannel(const omnetpp::cXMLElement* cfg)
     return channel;
 }
 
+struct ServiceListener
+{
+    boost::optional<PortNumber> port;
+    ChannelNumber channel;
+    bool channel_attribute;
+};
+
+struct ServiceConfig
+{
+    cModuleType* type;
+    std::string name;
+    const cXMLElement* filters;
+    std::vector<ServiceListener> listeners;
+};
+
+/**
+ * Parsed middleware configurations shared by all middleware instances of a run.
+ *
+ * Nodes are created and deleted frequently in high churn scenarios,
+ * but they are usually configured by a handful of XML documents only.
+ */
+struct ConfigCache
+{
+    std::string run;
+    std::map<const cXMLElement*, std::vector<ServiceConfig>> services;
+    std::map<const cXMLElement*, std::shared_ptr<const MultiChannelPolicy>> policies;
+};
+
+ConfigCache& getConfigCache()
+{
+    static ConfigCache cache;
+    // XML elements are owned by OMNeT++'s document cache which might be flushed between runs
+    const char* run = getEnvir()->getConfigEx()->getVariable(CFGVAR_RUNID);
+    if (cache.run != run) {
+        cache = ConfigCache {};
+        cache.run = run;
+    }
+    return cache;
+}
+
+const std::vector<ServiceConfig>& getServiceConfigs(const cXMLElement* config)
+{
+    auto& services = getConfigCache().services;
+    auto found = services.find(config);
+    if (found != services.end()) {
+        return found->second;
+    }
+
+    std::vector<ServiceConfig> configs;
+    for (const cXMLElement* service_cfg : config->getChildrenByTagName("service")) {
+        ServiceConfig service;
+        service.type = cModuleType::get(service_cfg->getAttribute("type"));
+        service.name = service_cfg->getAttribute("name") ?
+            service_cfg->getAttribute("name") : service.type->getName();
+        service.filters = service_cfg->getFirstChildWithTag("filters");
+
+        for (const cXMLElement* listener_cfg : service_cfg->getChildrenByTagName("listener")) {
+            ServiceListener listener;
+            if (listener_cfg->getAttribute("port")) {
+                listener.port = boost::lexical_cast<PortNumber>(listener_cfg->getAttribute("port"));
+            }
+            listener.channel = getChannel(listener_cfg);
+            listener.channel_attribute = listener_cfg->getAttribute("channel") != nullptr;
+            service.listeners.push_back(listener);
+        }
+
+        configs.push_back(std::move(service));
+    }
+    return services.emplace(config, std::move(configs)).first->second;
+}
+
+std::shared_ptr<const MultiChannelPolicy> getMultiChannelPolicy(const cXMLElement* config)
+{
+    auto& policy = getConfigCache().policies[config];
+    if (!policy) {
+        policy = std::make_shared<XmlMultiChannelPolicy>(config);
+    }
+    return policy;
+}
+
 } // namespace
 
 Middleware::Middleware() : mLocalDynamicMap(mTimer)
@@ -68,7 +153,7 @@ void Middleware::initialize(int stage)
         mUpdateMessage = new cMessage("middleware update");
         mIdentity.host = findHost();
         mIdentity.host->subscribe(Identity::changeSignal, this);
-        mMultiChannelPolicy.reset(new XmlMultiChannelPolicy(par("mcoPolicy").xmlValue()));
+        mMultiChannelPolicy = getMultiChannelPolicy(par("mcoPolicy").xmlValue());
     } else if (stage == InitStages::Self) {
         mFacilities.register_const(&mTimer);
         mFacilities.register_mutable(&mLocalDynamicMap);
@@ -90,21 +175,17 @@ void Middleware::initialize(int stage)
 
 void Middleware::initializeServices(int stage)
 {
-    cXMLElement* config = par("services").xmlValue();
-    for (cXMLElement* service_cfg : config->getChildrenByTagName("service")) {
-        cModuleType* module_type = cModuleType::get(service_cfg->getAttribute("type"));
+    for (const ServiceConfig& service_cfg : getServiceConfigs(par("services").xmlValue())) {
+        cModuleType* module_type = service_cfg.type;
 
-        cXMLElement* service_filters = service_cfg->getFirstChildWithTag("filters");
         bool service_applicable = true;
-        if (service_filters) {
+        if (service_cfg.filters) {
             artery::FilterRules rules(getRNG(0), mIdentity);
-            service_applicable = rules.applyFilterConfig(*service_filters);
+            service_applicable = rules.applyFilterConfig(*service_cfg.filters);
         }
 
         if (service_applicable) {
-            const char* service_name = service_cfg->getAttribute("name") ?
-                service_cfg->getAttribute("name") : module_type->getName();
-            cModule* module = module_type->create(service_name, this);
+            cModule* module = module_type->create(service_cfg.name.c_str(), this);
             module->finalizeParameters();
             module->buildInside();
             module->scheduleStart(simTime());
@@ -135,16 +216,14 @@ void Middleware::initializeServices(int stage)
             unsigned channels = 0;
             auto promiscuous = dynamic_cast<ItsG5PromiscuousService*>(service);
 
-            for (const cXMLElement* listener : service_cfg->getChildrenByTagName("listener")) {
-                if (listener->getAttribute("port")) {
-                    auto port = boost::lexical_cast<PortNumber>(listener->getAttribute("port"));
-                    TransportDescriptor td = std::forward_as_tuple(getChannel(listener), port);
+            for (const ServiceListener& listener : service_cfg.listeners) {
+                if (listener.port) {
+                    TransportDescriptor td = std::forward_as_tuple(listener.channel, *listener.port);
                     mTransportDispatcher.addListener(service, td);
                     service->addTransportDescriptor(td);
                     ++ports;
-                } else if (promiscuous && listener->getAttribute("channel")) {
-                    ChannelNumber channel = getChannel(listener);
-                    mTransportDispatcher.addPromiscuousListener(promiscuous, channel);
+                } else if (promiscuous && listener.channel_attribute) {
+                    mTransportDispatcher.addPromiscuousListener(promiscuous, listener.channel);
                     ++channels;
                 }
             }
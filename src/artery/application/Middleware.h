@@ -85,7 +85,7 @@ class Middleware : public omnetpp::cSimpleModule, public omnetpp::cListener
 
         NetworkInterfaceTable mNetworkInterfaceTable;
         TransportDispatcher mTransportDispatcher;
-        std::unique_ptr<MultiChannelPolicy> mMultiChannelPolicy;
+        std::shared_ptr<const MultiChannelPolicy> mMultiChannelPolicy;
         std::set<ItsG5BaseService*> mServices;
 };
 
@@ -20,6 +20,7 @@ class BaseEnvironmentModelObject : public EnvironmentModelObject
 {
 public:
     const std::vector<Position>& getOutline() const override { return mOutline; }
+    const CompactOutline& getCompactOutline() const override { return mCompactOutline; }
     const Position& getAttachmentPoint(const SensorPosition& pos) const override;
     const Position& getCentrePoint() const override { return mCentrePoint; }
     Length getLength() const override { return mLength; }
@@ -31,6 +32,7 @@ protected:
     Length mWidth;
     Length mRadius;
     std::vector<Position> mOutline;
+    CompactOutline mCompactOutline; /*< to be assigned whenever mOutline changes */
     std::vector<Position> mAttachmentPoints;
     Position mCentrePoint;
 };
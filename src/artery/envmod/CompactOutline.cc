@@ -0,0 +1,194 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/CompactOutline.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace artery
+{
+
+namespace bg = boost::geometry;
+
+namespace
+{
+
+// separation is only reported beyond this margin to absorb rounding errors
+const double tolerance = 1e-6; /*< meter */
+
+} // namespace
+
+CompactOutline::CompactOutline(const std::vector<Position>& outline)
+{
+    assign(outline);
+}
+
+void CompactOutline::assign(const std::vector<Position>& outline)
+{
+    const std::size_t count = outline.size();
+    mX.resize(count);
+    mY.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        mX[i] = outline[i].x.value();
+        mY[i] = outline[i].y.value();
+    }
+
+    if (count > 0) {
+        const auto x = std::minmax_element(mX.begin(), mX.end());
+        const auto y = std::minmax_element(mY.begin(), mY.end());
+        bg::set<bg::min_corner, 0>(mBox, *x.first);
+        bg::set<bg::min_corner, 1>(mBox, *y.first);
+        bg::set<bg::max_corner, 0>(mBox, *x.second);
+        bg::set<bg::max_corner, 1>(mBox, *y.second);
+    } else {
+        bg::assign_inverse(mBox);
+    }
+
+    // distinct consecutive vertices, e.g. without closing vertex of closed rings
+    std::vector<std::size_t> ring;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t prev = ring.empty() ? count - 1 : ring.back();
+        if (mX[i] != mX[prev] || mY[i] != mY[prev]) {
+            ring.push_back(i);
+        }
+    }
+
+    // convexity: all turns have the same orientation and sum up to a single revolution
+    const std::size_t corners = ring.size();
+    mConvex = corners >= 3;
+    double orientation = 0.0;
+    double turning = 0.0;
+    for (std::size_t n = 0; n < corners && mConvex; ++n) {
+        const std::size_t i = ring[n];
+        const std::size_t j = ring[(n + 1) % corners];
+        const std::size_t k = ring[(n + 2) % corners];
+        const double ux = mX[j] - mX[i];
+        const double uy = mY[j] - mY[i];
+        const double vx = mX[k] - mX[j];
+        const double vy = mY[k] - mY[j];
+        const double turn = ux * vy - uy * vx;
+        turning += std::atan2(turn, ux * vx + uy * vy);
+        if (turn != 0.0) {
+            if (orientation == 0.0) {
+                orientation = turn;
+            } else if ((turn > 0.0) != (orientation > 0.0)) {
+                mConvex = false;
+            }
+        }
+    }
+    mConvex = mConvex && orientation != 0.0 && std::abs(std::abs(turning) - 2.0 * M_PI) < 1e-6;
+
+    mNormalX.clear();
+    mNormalY.clear();
+    mOffset.clear();
+    if (mConvex) {
+        for (std::size_t n = 0; n < corners; ++n) {
+            const std::size_t i = ring[n];
+            const std::size_t j = ring[(n + 1) % corners];
+            const double dx = mX[j] - mX[i];
+            const double dy = mY[j] - mY[i];
+            const double length = std::hypot(dx, dy);
+            // right-hand normal points outwards for counter-clockwise rings (positive orientation)
+            const double nx = (orientation > 0.0 ? dy : -dy) / length;
+            const double ny = (orientation > 0.0 ? -dx : dx) / length;
+            mNormalX.push_back(nx);
+            mNormalY.push_back(ny);
+            mOffset.push_back(nx * mX[i] + ny * mY[i]);
+        }
+    }
+}
+
+bool CompactOutline::isSeparated(const Position& a, const Position& b) const
+{
+    if (mX.empty()) {
+        return true;
+    }
+
+    const double ax = a.x.value();
+    const double ay = a.y.value();
+    const double bx = b.x.value();
+    const double by = b.y.value();
+
+    // bounding boxes
+    if (std::max(ax, bx) < bg::get<bg::min_corner, 0>(mBox) - tolerance ||
+        std::min(ax, bx) > bg::get<bg::max_corner, 0>(mBox) + tolerance ||
+        std::max(ay, by) < bg::get<bg::min_corner, 1>(mBox) - tolerance ||
+        std::min(ay, by) > bg::get<bg::max_corner, 1>(mBox) + tolerance)
+    {
+        return true;
+    }
+
+    // all vertices on one side of the segment's supporting line
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double length = std::hypot(dx, dy);
+    if (length > 0.0) {
+        const double ux = dx / length;
+        const double uy = dy / length;
+        double minSide = std::numeric_limits<double>::infinity();
+        double maxSide = -std::numeric_limits<double>::infinity();
+        const std::size_t count = mX.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            const double side = ux * (mY[i] - ay) - uy * (mX[i] - ax);
+            minSide = std::min(minSide, side);
+            maxSide = std::max(maxSide, side);
+        }
+        if (minSide > tolerance || maxSide < -tolerance) {
+            return true;
+        }
+    }
+
+    // both segment ends outside of the same edge of a convex polygon
+    const std::size_t edges = mOffset.size();
+    for (std::size_t i = 0; i < edges; ++i) {
+        const double da = mNormalX[i] * ax + mNormalY[i] * ay - mOffset[i];
+        const double db = mNormalX[i] * bx + mNormalY[i] * by - mOffset[i];
+        if (da > tolerance && db > tolerance) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CompactOutline::isSeparated(const CompactOutline& other) const
+{
+    if (mX.empty() || other.mX.empty()) {
+        return true;
+    }
+
+    if (bg::get<bg::max_corner, 0>(mBox) < bg::get<bg::min_corner, 0>(other.mBox) - tolerance ||
+        bg::get<bg::min_corner, 0>(mBox) > bg::get<bg::max_corner, 0>(other.mBox) + tolerance ||
+        bg::get<bg::max_corner, 1>(mBox) < bg::get<bg::min_corner, 1>(other.mBox) - tolerance ||
+        bg::get<bg::min_corner, 1>(mBox) > bg::get<bg::max_corner, 1>(other.mBox) + tolerance)
+    {
+        return true;
+    }
+
+    return isSeparatedByEdge(other) || other.isSeparatedByEdge(*this);
+}
+
+bool CompactOutline::isSeparatedByEdge(const CompactOutline& other) const
+{
+    // edge of a convex polygon separates if all vertices of the other polygon are beyond it
+    const std::size_t edges = mOffset.size();
+    const std::size_t count = other.mX.size();
+    const double* x = other.mX.data();
+    const double* y = other.mY.data();
+    for (std::size_t i = 0; i < edges; ++i) {
+        double nearest = std::numeric_limits<double>::infinity();
+        for (std::size_t j = 0; j < count; ++j) {
+            nearest = std::min(nearest, mNormalX[i] * x[j] + mNormalY[i] * y[j]);
+        }
+        if (nearest - mOffset[i] > tolerance) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace artery
@@ -0,0 +1,84 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_COMPACTOUTLINE_H_HV4TQ2ZS
+#define ENVMOD_COMPACTOUTLINE_H_HV4TQ2ZS
+
+#include "artery/envmod/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * CompactOutline stores a polygon as structure of arrays with precomputed bounding box
+ *
+ * Vertex coordinates are kept in contiguous plain double arrays, i.e. the separation tests
+ * loop over them without unit conversions and are amenable to vectorization.
+ * Separation tests are conservative: they only report certainly disjoint geometries
+ * and are thus suitable as fast rejection before exact boost::geometry predicates.
+ */
+class CompactOutline
+{
+public:
+    CompactOutline() = default;
+    explicit CompactOutline(const std::vector<Position>& outline);
+
+    /**
+     * Replace stored polygon
+     * \param outline polygon vertices (open or closed ring)
+     */
+    void assign(const std::vector<Position>& outline);
+
+    std::size_t size() const { return mX.size(); }
+    bool empty() const { return mX.empty(); }
+    const std::vector<double>& x() const { return mX; }
+    const std::vector<double>& y() const { return mY; }
+
+    /**
+     * Get axis-aligned bounding box, identical to boost::geometry::return_envelope
+     */
+    const geometry::Box& getBoundingBox() const { return mBox; }
+
+    /**
+     * Check if polygon is convex, edge normals are only available then
+     */
+    bool isConvex() const { return mConvex; }
+
+    /**
+     * Check if a line segment is certainly disjoint from the polygon's area
+     * \param a start of segment
+     * \param b end of segment
+     * \return true if disjoint, false if they may touch or intersect
+     */
+    bool isSeparated(const Position& a, const Position& b) const;
+
+    /**
+     * Check if two polygons are certainly disjoint
+     *
+     * Besides bounding boxes, edges of convex polygons are tested as separating axes.
+     * \param other outline
+     * \return true if disjoint, false if polygons may touch or intersect
+     */
+    bool isSeparated(const CompactOutline& other) const;
+
+private:
+    bool isSeparatedByEdge(const CompactOutline& other) const;
+
+    std::vector<double> mX;
+    std::vector<double> mY;
+    geometry::Box mBox;
+    bool mConvex = false;
+    // outward edge normals (unit length) and offsets of convex polygons
+    std::vector<double> mNormalX;
+    std::vector<double> mNormalY;
+    std::vector<double> mOffset;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_COMPACTOUTLINE_H_HV4TQ2ZS */
@@ -7,6 +7,7 @@
 #ifndef EVIRONMENTMODELOBJECT_H_
 #define EVIRONMENTMODELOBJECT_H_
 
+#include "artery/envmod/CompactOutline.h"
 #include "artery/envmod/sensor/SensorPosition.h"
 #include "artery/utility/Geometry.h"
 #include <vanetza/units/length.hpp>
@@ -46,6 +47,12 @@ public:
      */
     virtual const std::vector<Position>& getOutline() const = 0;
 
+    /**
+     * Returns the object's outline prepared for fast geometric tests
+     * @return outline matching getOutline()
+     */
+    virtual const CompactOutline& getCompactOutline() const = 0;
+
     /**
      * Returns a sensor attachment point of the object
      * @param pos logical position of sensor
@@ -7,6 +7,7 @@
 #ifndef ENVIRONMENTMODELOBSTACLE_H_
 #define ENVIRONMENTMODELOBSTACLE_H_
 
+#include "artery/envmod/CompactOutline.h"
 #include "artery/envmod/EnvironmentModelObject.h"
 #include "artery/utility/Geometry.h"
 #include <string>
@@ -22,7 +23,7 @@ class EnvironmentModelObstacle
 {
 public:
     EnvironmentModelObstacle(std::string id, std::vector<Position> outline) :
-        mId(id), mPolygon(outline) {}
+        mId(id), mPolygon(outline), mCompactPolygon(mPolygon) {}
 
     /**
      * Returns the obstacle id
@@ -36,9 +37,16 @@ public:
      */
     const std::vector<Position>& getOutline() const { return mPolygon; }
 
+    /**
+     * Returns the obstacle coords prepared for fast geometric tests
+     * @return compact obstacle outline
+     */
+    const CompactOutline& getCompactOutline() const { return mCompactPolygon; }
+
 private:
     std::string mId; //!< Unique obstacle id
     std::vector<Position> mPolygon; //!< Obstacle outline
+    CompactOutline mCompactPolygon; //!< Obstacle outline as structure of arrays
 };
 
 
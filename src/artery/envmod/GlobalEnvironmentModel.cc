@@ -6,6 +6,7 @@
 
 #include "artery/envmod/GlobalEnvironmentModel.h"
 #include "artery/envmod/Geometry.h"
+#include "artery/envmod/LocalEnvironmentModel.h"
 #include "artery/envmod/TraCIEnvironmentModelObject.h"
 #include "artery/envmod/sensor/SensorConfiguration.h"
 #include "artery/traci/Cast.h"
@@ -18,6 +19,7 @@
 #include <inet/common/ModuleAccess.h>
 #include <algorithm>
 #include <array>
+#include <chrono>
 
 using namespace omnetpp;
 
@@ -34,6 +36,8 @@ const simsignal_t traciCloseSignal = cComponent::registerSignal("traci.close");
 const simsignal_t traciNodeAddSignal = cComponent::registerSignal("traci.node.add");
 const simsignal_t traciNodeRemoveSignal = cComponent::registerSignal("traci.node.remove");
 const simsignal_t traciNodeUpdateSignal = cComponent::registerSignal("traci.node.update");
+const simsignal_t indexUpdateTimeSignal = cComponent::registerSignal("objectIndexUpdateTime");
+const simsignal_t measurementTimeSignal = cComponent::registerSignal("sensorMeasurementTime");
 
 template<typename RT>
 typename RT::const_query_iterator
@@ -63,11 +67,18 @@ GlobalEnvironmentModel::~GlobalEnvironmentModel()
 
 void GlobalEnvironmentModel::refresh()
 {
+    std::chrono::steady_clock::duration indexing = std::chrono::steady_clock::duration::zero();
     for (auto& object_kv : mObjects) {
         object_kv.second->update();
+        const auto start = std::chrono::steady_clock::now();
+        mObjectIndex->update(object_kv.second);
+        indexing += std::chrono::steady_clock::now() - start;
     }
 
-    buildObjectRtree();
+    const auto start = std::chrono::steady_clock::now();
+    mObjectIndex->commit();
+    indexing += std::chrono::steady_clock::now() - start;
+    emit(indexUpdateTimeSignal, std::chrono::duration<double>(indexing).count());
 
     if (mDrawVehicles) {
         int numObjects = mObjects.size();
@@ -102,7 +113,34 @@ void GlobalEnvironmentModel::refresh()
         }
     }
 
+    const auto measurementStart = std::chrono::steady_clock::now();
     emit(refreshSignal, this);
+    runDeferredMeasurements();
+    emit(measurementTimeSignal, std::chrono::duration<double>(std::chrono::steady_clock::now() - measurementStart).count());
+}
+
+void GlobalEnvironmentModel::deferMeasurements(LocalEnvironmentModel* local)
+{
+    ASSERT(mWorkerPool);
+    mDeferredMeasurements.push_back(local);
+}
+
+void GlobalEnvironmentModel::runDeferredMeasurements()
+{
+    if (mDeferredMeasurements.empty()) {
+        return;
+    }
+
+    // detections only read global state and each local model's own sensors
+    mWorkerPool->run(mDeferredMeasurements.size(), [this](std::size_t i) {
+        mDeferredMeasurements[i]->computeMeasurements();
+    });
+
+    // sequential completion in deferral order keeps results deterministic
+    for (LocalEnvironmentModel* local : mDeferredMeasurements) {
+        local->completeMeasurements();
+    }
+    mDeferredMeasurements.clear();
 }
 
 bool GlobalEnvironmentModel::addObject(traci::Controller* controller)
@@ -118,10 +156,9 @@ bool GlobalEnvironmentModel::addObject(traci::Controller* controller)
     auto object = std::make_shared<TraCIEnvironmentModelObject>(controller, id);
     auto insertion = mObjects.emplace(object->getExternalId(), object);
     if (insertion.second) {
-        auto box = boost::geometry::return_envelope<geometry::Box>(object->getOutline());
-        mObjectRtree.insert(ObjectRtreeValue { std::move(box), object });
+        mObjectIndex->insert(object);
     }
-    ASSERT(mObjects.size() == mObjectRtree.size());
+    ASSERT(mObjects.size() == mObjectIndex->size());
     return insertion.second;
 }
 
@@ -157,44 +194,35 @@ void GlobalEnvironmentModel::buildObstacleRtree()
         inline ObstacleRtreeValue operator()(const ObstacleDB::value_type& item) const
         {
             const auto& obstacle = item.second;
-            auto box = boost::geometry::return_envelope<geometry::Box>(obstacle->getOutline());
+            auto box = obstacle->getCompactOutline().getBoundingBox();
             return ObstacleRtreeValue { std::move(box), obstacle };
         }
     };
 
     // bulk loading of obstacles for efficient packing
     mObstacleRtree = ObstacleRtree { mObstacles | boost::adaptors::transformed(envelope_maker()) };
-}
-
-void GlobalEnvironmentModel::buildObjectRtree()
-{
-    struct envelope_maker
-    {
-        inline ObjectRtreeValue operator()(const ObjectDB::value_type& obj_kv) const
-        {
-            const std::shared_ptr<EnvironmentModelObject>& obj = obj_kv.second;
-            auto box = boost::geometry::return_envelope<geometry::Box>(obj->getOutline());
-            return ObjectRtreeValue { std::move(box), obj };
-        }
-    };
-
-    // use bulk loading for efficient packing
-    mObjectRtree = ObjectRtree { mObjects | boost::adaptors::transformed(envelope_maker()) };
-    mTainted = false;
+    ++mObstacleRevision;
 }
 
 bool GlobalEnvironmentModel::removeObject(const std::string& objectId)
 {
-    bool erased = mObjects.erase(objectId) > 0;
-    mTainted |= erased; /*< pending object rtree update */
-    return erased;
+    auto found = mObjects.find(objectId);
+    if (found != mObjects.end()) {
+        mObjectIndex->remove(found->second);
+        mObjects.erase(found);
+        ++mObjectRemovalRevision;
+        return true;
+    }
+    return false;
 }
 
 void GlobalEnvironmentModel::removeObjects()
 {
     mObjects.clear();
-    mObjectRtree.clear();
-    mTainted = false;
+    ++mObjectRemovalRevision;
+    if (mObjectIndex) {
+        mObjectIndex->clear();
+    }
 
     if (mDrawVehicles) {
         // remove all polygons
@@ -209,6 +237,7 @@ void GlobalEnvironmentModel::clear()
     removeObjects();
     mObstacles.clear();
     mObstacleRtree.clear();
+    ++mObstacleRevision;
 }
 
 void GlobalEnvironmentModel::initialize()
@@ -226,7 +255,21 @@ void GlobalEnvironmentModel::initialize()
     }
 
     mIdentityRegistry = inet::findModuleFromPar<IdentityRegistry>(par("identityRegistryModule"), this);
-    mTainted = false;
+
+    const std::string objectIndex = par("objectIndex");
+    const double objectIndexParameter = objectIndex == "grid" ? par("objectIndexCellSize") : par("objectIndexMargin");
+    mObjectIndex = createObjectIndex(objectIndex, objectIndexParameter);
+    if (!mObjectIndex) {
+        throw cRuntimeError("unknown object index \"%s\"", objectIndex.c_str());
+    }
+
+    const int measurementThreads = par("measurementThreads");
+    if (measurementThreads < 0) {
+        throw cRuntimeError("measurementThreads must not be negative");
+    } else if (measurementThreads != 1) {
+        mWorkerPool.reset(new WorkerPool(measurementThreads));
+        EV_INFO << "computing sensor measurements with " << mWorkerPool->size() << " threads\n";
+    }
 
     if (par("drawObstacles")) {
         mDrawObstacles = new omnetpp::cGroupFigure("obstacles");
@@ -340,8 +383,6 @@ std::shared_ptr<EnvironmentModelObstacle> GlobalEnvironmentModel::getObstacle(co
 std::vector<std::shared_ptr<EnvironmentModelObject>>
 GlobalEnvironmentModel::preselectObjects(const std::string& ego, const std::vector<Position>& area)
 {
-    ASSERT(!mTainted);
-
     boost::geometry::validity_failure_type failure;
     if (!boost::geometry::is_valid(area, failure)) {
         std::string error_msg =  boost::geometry::validity_failure_type_message(failure);
@@ -349,12 +390,11 @@ GlobalEnvironmentModel::preselectObjects(const std::string& ego, const std::vect
     }
 
     std::vector<std::shared_ptr<EnvironmentModelObject>> objectsInSearchArea;
-    ObjectRtree::const_query_iterator it = query_intersections(mObjectRtree, area);
-    for (; it != mObjectRtree.qend(); ++it) {
-        if (it->second->getExternalId() != ego && it->second->isVisible()) {
-            objectsInSearchArea.push_back(it->second);
+    mObjectIndex->query(area, [&](const std::shared_ptr<EnvironmentModelObject>& object) {
+        if (object->getExternalId() != ego && object->isVisible()) {
+            objectsInSearchArea.push_back(object);
         }
-    }
+    });
     return objectsInSearchArea;
 }
 
@@ -11,6 +11,8 @@
 #include "artery/envmod/Geometry.h"
 #include "artery/envmod/EnvironmentModelObject.h"
 #include "artery/envmod/EnvironmentModelObstacle.h"
+#include "artery/envmod/ObjectIndex.h"
+#include "artery/envmod/WorkerPool.h"
 #include "artery/utility/Geometry.h"
 #include <omnetpp/ccanvas.h>
 #include <omnetpp/clistener.h>
@@ -33,6 +35,7 @@ namespace artery
 
 class EnvironmentModelObstacle;
 class IdentityRegistry;
+class LocalEnvironmentModel;
 
 /**
  * The GlobalEnvironmentModel has the global view of all objects and obstacles
@@ -91,12 +94,45 @@ public:
     std::vector<std::shared_ptr<EnvironmentModelObstacle>>
     preselectObstacles(const std::vector<Position>& area);
 
+    /**
+     * Get revision of the obstacle database
+     * @return number changing whenever obstacles are (re-)loaded or cleared
+     */
+    unsigned getObstacleRevision() const { return mObstacleRevision; }
+
+    /**
+     * Get revision of the object database's removals
+     * @return number changing whenever objects are removed
+     */
+    unsigned getObjectRemovalRevision() const { return mObjectRemovalRevision; }
+
+    /**
+     * Check if sensor measurements are computed by a pool of worker threads
+     * @return true if local models shall defer their measurements
+     */
+    bool hasWorkerPool() const { return static_cast<bool>(mWorkerPool); }
+
+    /**
+     * Defer measurements of a local model during refresh
+     *
+     * Measurements of all deferred local models are computed concurrently after
+     * the refresh signal has been emitted. Afterwards, they are completed one after another
+     * in the order of deferral, i.e. results do not depend on thread scheduling.
+     * @param local model with prepared measurements
+     */
+    void deferMeasurements(LocalEnvironmentModel* local);
+
 private:
     /**
      * Refresh all dynamic objects in the database.
      */
     void refresh();
 
+    /**
+     * Compute and complete deferred measurements
+     */
+    void runDeferredMeasurements();
+
     /**
      * Add object to the environment database
      * @param vehicle TraCI mobility corresponding to vehicle
@@ -130,11 +166,6 @@ private:
      */
     void buildObstacleRtree();
 
-    /**
-     * Create the object rtree.
-     */
-    void buildObjectRtree();
-
     /**
      * Clears the internal database completely
      */
@@ -154,18 +185,19 @@ private:
     virtual traci::Controller* getController(omnetpp::cModule* mod);
 
     using ObjectDB = std::unordered_map<std::string, std::shared_ptr<EnvironmentModelObject>>;
-    using ObjectRtreeValue = std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObject>>;
-    using ObjectRtree = boost::geometry::index::rtree<ObjectRtreeValue, boost::geometry::index::quadratic<16>>;
     using ObstacleDB = std::unordered_map<std::string, std::shared_ptr<EnvironmentModelObstacle>>;
     using ObstacleRtreeValue = std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObstacle>>;
     using ObstacleRtree = boost::geometry::index::rtree<ObstacleRtreeValue, boost::geometry::index::rstar<16>>;
 
     ObjectDB mObjects;
-    ObjectRtree mObjectRtree;
+    std::unique_ptr<ObjectIndex> mObjectIndex;
     ObstacleDB mObstacles;
     ObstacleRtree mObstacleRtree;
+    unsigned mObstacleRevision = 0;
+    unsigned mObjectRemovalRevision = 0;
+    std::unique_ptr<WorkerPool> mWorkerPool;
+    std::vector<LocalEnvironmentModel*> mDeferredMeasurements;
     IdentityRegistry* mIdentityRegistry;
-    bool mTainted = false;
     omnetpp::cGroupFigure* mDrawObstacles = nullptr;
     omnetpp::cGroupFigure* mDrawVehicles = nullptr;
     std::set<std::string> mObstacleTypes;
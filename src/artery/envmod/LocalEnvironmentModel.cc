@@ -12,6 +12,9 @@
 #include "artery/utility/FilterRules.h"
 #include <inet/common/ModuleAccess.h>
 #include <omnetpp/cxmlelement.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <utility>
 
 using namespace omnetpp;
@@ -23,6 +26,38 @@ Define_Module(LocalEnvironmentModel)
 
 static const simsignal_t EnvironmentModelRefreshSignal = cComponent::registerSignal("EnvironmentModel.refresh");
 
+namespace
+{
+
+inline std::size_t lowestBit(LocalEnvironmentModel::SensorMask mask)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(mask);
+#else
+    std::size_t bit = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+inline std::size_t countBits(LocalEnvironmentModel::SensorMask mask)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(mask);
+#else
+    std::size_t bits = 0;
+    for (; mask; mask &= mask - 1) {
+        ++bits;
+    }
+    return bits;
+#endif
+}
+
+} // namespace
+
 LocalEnvironmentModel::LocalEnvironmentModel() :
     mGlobalEnvironmentModel(nullptr)
 {
@@ -44,6 +79,8 @@ void LocalEnvironmentModel::initialize(int stage)
         Facilities& fac = mMiddleware->getFacilities();
         fac.register_mutable(mGlobalEnvironmentModel);
         fac.register_mutable(this);
+
+        mFusedPreselection = par("fusedPreselection");
     } else if (stage == 1) {
         initializeSensors();
     }
@@ -53,44 +90,228 @@ void LocalEnvironmentModel::finish()
 {
     mGlobalEnvironmentModel->unsubscribe(EnvironmentModelRefreshSignal, this);
     mObjects.clear();
+    mObjectKeys.clear();
+    mObjectRows.clear();
+    for (auto& expiries : mExpiries) {
+        expiries.clear();
+    }
 }
 
 void LocalEnvironmentModel::receiveSignal(cComponent*, simsignal_t signal, cObject* obj, cObject*)
 {
     if (signal == EnvironmentModelRefreshSignal) {
-        for (auto* sensor : mSensors) {
-            sensor->measurement();
+        scheduleMeasurements();
+        prepareMeasurements();
+        if (mPreselecting && mGlobalEnvironmentModel->hasWorkerPool()) {
+            // global model computes and completes measurements of all local models in one batch
+            mGlobalEnvironmentModel->deferMeasurements(this);
+        } else {
+            completeMeasurements();
         }
-        update();
     }
 }
 
+void LocalEnvironmentModel::scheduleMeasurements()
+{
+    mRefreshTime = simTime();
+    mScheduledSensors.clear();
+    for (std::size_t i = 0; i < mSensors.size(); ++i) {
+        const SimTime period = mSensors[i]->getUpdatePeriod();
+        if (period.isZero() || mMeasurementTimes[i] + period <= mRefreshTime) {
+            mScheduledSensors.push_back(i);
+        } else {
+            // measure on demand unless update period elapses first
+            mPendingSensors[i] = true;
+        }
+    }
+}
+
+void LocalEnvironmentModel::measurePendingSensors() const
+{
+    if (mPreselecting || mMeasuring) {
+        return; /*< batch of measurements is in progress */
+    }
+
+    mScheduledSensors.clear();
+    for (std::size_t i = 0; i < mPendingSensors.size(); ++i) {
+        if (mPendingSensors[i]) {
+            mScheduledSensors.push_back(i);
+        }
+    }
+
+    if (!mScheduledSensors.empty()) {
+        prepareScheduledSensors();
+        measureScheduledSensors();
+    }
+}
+
+void LocalEnvironmentModel::prepareMeasurements()
+{
+    prepareScheduledSensors();
+}
+
+void LocalEnvironmentModel::prepareScheduledSensors() const
+{
+    if (mFusedPreselection && !mScheduledSensors.empty()) {
+        // single broad-phase query covering the areas of all sensors
+        mPreselection.reset(mGlobalEnvironmentModel, mMiddleware->getIdentity().traci);
+        mPreselecting = true;
+        for (std::size_t i : mScheduledSensors) {
+            mSensors[i]->prepareMeasurement(mPreselection);
+        }
+        mPreselection.fetch();
+    }
+}
+
+void LocalEnvironmentModel::computeMeasurements()
+{
+    for (std::size_t i : mScheduledSensors) {
+        mSensors[i]->computeMeasurement();
+    }
+}
+
+void LocalEnvironmentModel::completeMeasurements()
+{
+    measureScheduledSensors();
+}
+
+void LocalEnvironmentModel::measureScheduledSensors() const
+{
+    // detections reflect the global model's state at its latest refresh
+    mMeasuring = true;
+    for (std::size_t i : mScheduledSensors) {
+        mSensors[i]->measurement();
+        mMeasurementTimes[i] = mRefreshTime;
+        mPendingSensors[i] = false;
+    }
+    mMeasuring = false;
+    mScheduledSensors.clear();
+    mPreselecting = false;
+    expireTrackings();
+}
+
+const LocalEnvironmentModel::TrackedObjects& LocalEnvironmentModel::allObjects() const
+{
+    measurePendingSensors();
+    return mObjects;
+}
+
+const std::vector<Sensor*>& LocalEnvironmentModel::getSensors() const
+{
+    measurePendingSensors();
+    return mSensors;
+}
+
 void LocalEnvironmentModel::complementObjects(const SensorDetection& detection, const Sensor& sensor)
 {
-   for (auto& detectedObject : detection.objects) {
-      auto foundObject = mObjects.find(detectedObject);
-      if (foundObject != mObjects.end()) {
-         Tracking& tracking = foundObject->second;
-         tracking.tap(&sensor);
-      } else {
-         mObjects.emplace(detectedObject, Tracking { ++mTrackingCounter, &sensor });
-      }
-   }
+    const std::size_t slot = getSensorSlot(&sensor);
+    const SimTime time = mMeasuring ? mRefreshTime : simTime();
+    for (auto& detectedObject : detection.objects) {
+        if (!detectedObject) {
+            continue;
+        }
+
+        auto row = mObjectRows.find(detectedObject.get());
+        if (row == mObjectRows.end()) {
+            row = mObjectRows.emplace(detectedObject.get(), mObjects.size()).first;
+            mObjects.emplace_back(detectedObject, Tracking { ++mTrackingCounter, &mTrackingSensors });
+            mObjectKeys.push_back(detectedObject.get());
+        } else if (mObjects[row->second].first.owner_before(detectedObject) || detectedObject.owner_before(mObjects[row->second].first)) {
+            // vanished object's address has been reused by a new object
+            mObjects[row->second] = TrackedObject { detectedObject, Tracking { ++mTrackingCounter, &mTrackingSensors } };
+        }
+
+        Tracking& tracking = mObjects[row->second].second;
+        tracking.tap(slot, time);
+        mExpiries[slot].push_back(Expiry { tracking.mTimes[slot].last(), detectedObject.get(), tracking.id() });
+    }
 }
 
 void LocalEnvironmentModel::update()
 {
-    for (auto it = mObjects.begin(); it != mObjects.end();) {
-        const Object& object = it->first;
-        Tracking& tracking = it->second;
-        tracking.update();
+    expireTrackings();
+}
+
+void LocalEnvironmentModel::expireTrackings() const
+{
+    const SimTime now = simTime();
+    bool expired = false;
+    for (std::size_t slot = 0; slot < mTrackingSensors.size(); ++slot) {
+        const SimTime validity = mTrackingSensors[slot]->getValidityPeriod();
+        // deferred measurements shall not invalidate trackings in the meantime
+        const SimTime reference = slot < mMeasurementTimes.size() ? mMeasurementTimes[slot] : now;
+        auto& expiries = mExpiries[slot];
+        while (!expiries.empty() && expiries.front().last + validity < reference) {
+            const Expiry& expiry = expiries.front();
+            auto row = mObjectRows.find(expiry.object);
+            if (row != mObjectRows.end()) {
+                Tracking& tracking = mObjects[row->second].second;
+                // skip outdated expiries of re-detected objects
+                if (tracking.id() == expiry.id && tracking.lose(slot, expiry.last)) {
+                    expired |= tracking.expired();
+                }
+            }
+            expiries.pop_front();
+        }
+    }
+
+    const unsigned removals = mGlobalEnvironmentModel->getObjectRemovalRevision();
+    const bool vanished = removals != mObjectRemovalRevision;
+    mObjectRemovalRevision = removals;
+
+    if (expired || vanished) {
+        removeExpiredObjects(vanished);
+    }
+}
 
-        if (object.expired() || tracking.expired()) {
-            it = mObjects.erase(it);
+void LocalEnvironmentModel::removeExpiredObjects(bool vanished) const
+{
+    // compact table but preserve order of remaining objects
+    std::size_t row = 0;
+    for (std::size_t i = 0; i < mObjects.size(); ++i) {
+        if (mObjects[i].second.expired() || (vanished && mObjects[i].first.expired())) {
+            mObjectRows.erase(mObjectKeys[i]);
         } else {
-            ++it;
+            if (row != i) {
+                mObjects[row] = std::move(mObjects[i]);
+                mObjectKeys[row] = mObjectKeys[i];
+                mObjectRows[mObjectKeys[row]] = row;
+            }
+            ++row;
         }
     }
+    mObjects.erase(mObjects.begin() + row, mObjects.end());
+    mObjectKeys.resize(row);
+}
+
+std::size_t LocalEnvironmentModel::getSensorSlot(const Sensor* sensor)
+{
+    auto found = std::find(mTrackingSensors.begin(), mTrackingSensors.end(), sensor);
+    if (found != mTrackingSensors.end()) {
+        return std::distance(mTrackingSensors.begin(), found);
+    } else if (mTrackingSensors.size() >= std::numeric_limits<SensorMask>::digits) {
+        throw cRuntimeError("LocalEnvironmentModel cannot track more than %d sensors", std::numeric_limits<SensorMask>::digits);
+    }
+
+    const std::size_t slot = mTrackingSensors.size();
+    const SensorMask bit = SensorMask(1) << slot;
+    mTrackingSensors.push_back(sensor);
+    mExpiries.emplace_back();
+    mCategoryMasks[sensor->getSensorCategory()] |= bit;
+    mNameMasks[sensor->getSensorName()] |= bit;
+    return slot;
+}
+
+LocalEnvironmentModel::SensorMask LocalEnvironmentModel::getSensorCategoryMask(const std::string& category) const
+{
+    auto found = mCategoryMasks.find(category);
+    return found != mCategoryMasks.end() ? found->second : 0;
+}
+
+LocalEnvironmentModel::SensorMask LocalEnvironmentModel::getSensorNameMask(const std::string& name) const
+{
+    auto found = mNameMasks.find(name);
+    return found != mNameMasks.end() ? found->second : 0;
 }
 
 void LocalEnvironmentModel::initializeSensors()
@@ -128,45 +349,57 @@ void LocalEnvironmentModel::initializeSensors()
             module->scheduleStart(simTime());
             module->callInitialize();
             mSensors.push_back(sensor);
+            mMeasurementTimes.push_back(SimTime::ZERO);
+            mPendingSensors.push_back(false);
+            getSensorSlot(sensor);
         }
     }
 }
 
 
-LocalEnvironmentModel::Tracking::Tracking(int id, const Sensor* sensor) : mId(id)
+LocalEnvironmentModel::Tracking::Tracking(int id, const std::vector<const Sensor*>* sensors) :
+    mId(id), mSlots(sensors)
 {
-    mSensors.emplace(sensor, TrackingTime {});
 }
 
-bool LocalEnvironmentModel::Tracking::expired() const
+LocalEnvironmentModel::Tracking::SensorRange LocalEnvironmentModel::Tracking::sensors() const
 {
-    return mSensors.empty();
+    return SensorRange { SensorIterator { this, mSensorMask }, SensorIterator { this, 0 } };
 }
 
-void LocalEnvironmentModel::Tracking::update()
+std::size_t LocalEnvironmentModel::Tracking::SensorRange::size() const
 {
-    for (auto it = mSensors.begin(); it != mSensors.end();) {
-      const Sensor* sensor = it->first;
-      const TrackingTime& tracking = it->second;
+    return countBits(begin().mask());
+}
 
-      const bool expired = tracking.last() + sensor->getValidityPeriod() < simTime();
-      if (expired) {
-          it = mSensors.erase(it);
-      } else {
-          ++it;
-      }
+void LocalEnvironmentModel::Tracking::tap(std::size_t slot, SimTime time)
+{
+    const SensorMask bit = SensorMask(1) << slot;
+    if (mSensorMask & bit) {
+        mTimes[slot].tap(time);
+    } else {
+        if (slot >= mTimes.size()) {
+            mTimes.resize(slot + 1);
+        }
+        mTimes[slot] = TrackingTime { time };
+        mSensorMask |= bit;
     }
 }
 
-void LocalEnvironmentModel::Tracking::tap(const Sensor* sensor)
+bool LocalEnvironmentModel::Tracking::lose(std::size_t slot, SimTime last)
 {
-    auto found = mSensors.find(sensor);
-    if (found != mSensors.end()) {
-         TrackingTime& tracking = found->second;
-         tracking.tap();
-    } else {
-         mSensors.emplace(sensor, TrackingTime {});
+    const SensorMask bit = SensorMask(1) << slot;
+    if ((mSensorMask & bit) && mTimes[slot].last() == last) {
+        mSensorMask &= ~bit;
+        return true;
     }
+    return false;
+}
+
+LocalEnvironmentModel::Tracking::SensorTracking LocalEnvironmentModel::Tracking::SensorIterator::dereference() const
+{
+    const std::size_t slot = lowestBit(mMask);
+    return SensorTracking { (*mTracking->mSlots)[slot], mTracking->mTimes[slot] };
 }
 
 
@@ -175,11 +408,32 @@ LocalEnvironmentModel::TrackingTime::TrackingTime() :
 {
 }
 
+LocalEnvironmentModel::TrackingTime::TrackingTime(SimTime time) :
+   mFirst(time), mLast(time)
+{
+}
+
 void LocalEnvironmentModel::TrackingTime::tap()
 {
     mLast = simTime();
 }
 
+void LocalEnvironmentModel::TrackingTime::tap(SimTime time)
+{
+    mLast = time;
+}
+
+
+TrackedObjectsFilterRange filterBySensorMask(const LocalEnvironmentModel::TrackedObjects& all, LocalEnvironmentModel::SensorMask mask)
+{
+    TrackedObjectsFilterPredicate seenBySensors = [mask](const LocalEnvironmentModel::TrackedObject& obj) {
+        return (obj.second.sensorMask() & mask) != 0;
+    };
+
+    auto begin = boost::make_filter_iterator(seenBySensors, all.begin(), all.end());
+    auto end = boost::make_filter_iterator(seenBySensors, all.end(), all.end());
+    return boost::make_iterator_range(begin, end);
+}
 
 TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel::TrackedObjects& all, const std::string& category)
 {
@@ -187,7 +441,7 @@ TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel::Tr
     TrackedObjectsFilterPredicate seenByCategory = [category](const LocalEnvironmentModel::TrackedObject& obj) {
         const auto& detections = obj.second.sensors();
         return std::any_of(detections.begin(), detections.end(),
-                [&category](const LocalEnvironmentModel::Tracking::TrackingMap::value_type& tracking) {
+                [&category](const LocalEnvironmentModel::Tracking::SensorTracking& tracking) {
                     const Sensor* sensor = tracking.first;
                     return sensor->getSensorCategory() == category;
                 });
@@ -200,11 +454,11 @@ TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel::Tr
 
 TrackedObjectsFilterRange filterBySensorName(const LocalEnvironmentModel::TrackedObjects& all, const std::string& name)
 {
-    // capture `category` by value because lambda expression will be evaluated after this function's return
+    // capture `name` by value because lambda expression will be evaluated after this function's return
     TrackedObjectsFilterPredicate seenByName = [name](const LocalEnvironmentModel::TrackedObject& obj) {
         const auto& detections = obj.second.sensors();
         return std::any_of(detections.begin(), detections.end(),
-                [&name](const LocalEnvironmentModel::Tracking::TrackingMap::value_type& tracking) {
+                [&name](const LocalEnvironmentModel::Tracking::SensorTracking& tracking) {
                     const Sensor* sensor = tracking.first;
                     return sensor->getSensorName() == name;
                 });
@@ -215,4 +469,14 @@ TrackedObjectsFilterRange filterBySensorName(const LocalEnvironmentModel::Tracke
     return boost::make_iterator_range(begin, end);
 }
 
+TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel& lem, const std::string& category)
+{
+    return filterBySensorMask(lem.allObjects(), lem.getSensorCategoryMask(category));
+}
+
+TrackedObjectsFilterRange filterBySensorName(const LocalEnvironmentModel& lem, const std::string& name)
+{
+    return filterBySensorMask(lem.allObjects(), lem.getSensorNameMask(name));
+}
+
 } // namespace artery
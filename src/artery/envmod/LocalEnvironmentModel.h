@@ -7,14 +7,21 @@
 #ifndef LOCALENVIRONMENTMODEL_H_
 #define LOCALENVIRONMENTMODEL_H_
 
+#include "artery/envmod/sensor/SensorPreselection.h"
+#include <boost/container/small_vector.hpp>
 #include <boost/iterator/filter_iterator.hpp>
+#include <boost/iterator/iterator_facade.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <omnetpp/clistener.h>
 #include <omnetpp/csimplemodule.h>
 #include <omnetpp/simtime.h>
+#include <cstdint>
+#include <deque>
 #include <functional>
-#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace artery
@@ -31,17 +38,29 @@ class SensorDetection;
  *
  * LocalEnvironmentModel tracks the GlobalEnvironmentModel's objects
  * visible by the local sensors feeding this local model.
+ * Tracked objects are stored in a dense table and each sensor's trackings
+ * expire in order of their last detection, i.e. updates do not scan all trackings.
+ *
+ * Sensors with a non-zero update period measure only once their period has elapsed
+ * or when tracked objects or sensors are accessed, whatever comes first.
  */
 class LocalEnvironmentModel : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
 public:
     using Object = std::weak_ptr<EnvironmentModelObject>;
 
+    /**
+     * Bit set of sensors, bit positions are the sensors' tracking slots
+     */
+    using SensorMask = std::uint64_t;
+
     class TrackingTime
     {
     public:
         TrackingTime();
+        explicit TrackingTime(omnetpp::SimTime);
         void tap();
+        void tap(omnetpp::SimTime);
 
         omnetpp::SimTime first() const { return mFirst; }
         omnetpp::SimTime last() const { return mLast; }
@@ -54,24 +73,67 @@ public:
     class Tracking
     {
     public:
-        using TrackingMap = std::map<const Sensor*, TrackingTime>;
+        using SensorTracking = std::pair<const Sensor*, TrackingTime>;
+
+        /**
+         * Iterates over tracking sensors in slot order, yields SensorTracking values
+         */
+        class SensorIterator : public boost::iterator_facade<SensorIterator,
+            SensorTracking, boost::forward_traversal_tag, SensorTracking>
+        {
+        public:
+            SensorIterator() = default;
+            SensorIterator(const Tracking* tracking, SensorMask mask) : mTracking(tracking), mMask(mask) {}
+
+            SensorMask mask() const { return mMask; }
+
+        private:
+            friend class boost::iterator_core_access;
+            SensorTracking dereference() const;
+            void increment() { mMask &= mMask - 1; }
+            bool equal(const SensorIterator& other) const { return mMask == other.mMask; }
+
+            const Tracking* mTracking = nullptr;
+            SensorMask mMask = 0;
+        };
+
+        class SensorRange : public boost::iterator_range<SensorIterator>
+        {
+        public:
+            using boost::iterator_range<SensorIterator>::iterator_range;
+
+            /**
+             * Number of tracking sensors without iterating them
+             */
+            std::size_t size() const;
+        };
 
-        Tracking(int id, const Sensor* sensor);
+        /**
+         * \param id tracking identifier
+         * \param sensors slot table of tracking local environment model
+         */
+        Tracking(int id, const std::vector<const Sensor*>* sensors);
 
-        bool expired() const;
-        void update();
-        void tap(const Sensor*);
+        bool expired() const { return mSensorMask == 0; }
 
         int id() const { return mId; }
-        const TrackingMap& sensors() const { return mSensors; }
+        SensorMask sensorMask() const { return mSensorMask; }
+        SensorRange sensors() const;
 
     private:
+        friend class LocalEnvironmentModel;
+
+        void tap(std::size_t slot, omnetpp::SimTime time);
+        bool lose(std::size_t slot, omnetpp::SimTime last);
+
         int mId;
-        TrackingMap mSensors;
+        SensorMask mSensorMask = 0;
+        boost::container::small_vector<TrackingTime, 4> mTimes; /*< indexed by sensor slot */
+        const std::vector<const Sensor*>* mSlots;
     };
 
-    using TrackedObjects = std::map<Object, Tracking, std::owner_less<Object>>;
-    using TrackedObject = typename TrackedObjects::value_type;
+    using TrackedObject = std::pair<Object, Tracking>;
+    using TrackedObjects = std::vector<TrackedObject>;
 
 
     LocalEnvironmentModel();
@@ -87,9 +149,29 @@ public:
      *
      * This method is supposed to get called at each TraCI simulation step.
      * Expired and no longer existing objects are removed from the local tracking.
+     * Trackings of a sensor expire relative to the time of its latest measurement.
      */
     void update();
 
+    /**
+     * Prepare measurements of scheduled sensors, i.e. fetch shared preselection
+     *
+     * Measurements are carried out in three steps:
+     * prepareMeasurements and completeMeasurements run on the main thread,
+     * computeMeasurements may run concurrently to other local environment models in between.
+     */
+    void prepareMeasurements();
+
+    /**
+     * Compute detections of prepared measurements
+     */
+    void computeMeasurements();
+
+    /**
+     * Apply detections of all sensors and update tracked objects
+     */
+    void completeMeasurements();
+
     /**
      * Complements the local database with the sensor data objects
      * @param objs Sensor detection result including objects and obstacles
@@ -99,32 +181,91 @@ public:
 
     /**
      * Get all currently seen objects by any local sensor
+     *
+     * Pending measurements are carried out before.
+     * Objects are listed in order of their first detection.
+     */
+    const TrackedObjects& allObjects() const;
+
+    /**
+     * Get mask of all sensors belonging to a category
+     * \param category sensor category, e.g. "Radar"
+     * \return sensor mask, zero if no sensor matches
+     */
+    SensorMask getSensorCategoryMask(const std::string& category) const;
+
+    /**
+     * Get mask of all sensors with given name
+     * \param name sensor name
+     * \return sensor mask, zero if no sensor matches
      */
-    const TrackedObjects& allObjects() const { return mObjects; }
+    SensorMask getSensorNameMask(const std::string& name) const;
 
     /**
      * Get list of all sensors attached to this local entity
      *
      * Sensor pointers are only valid as long as this LocalEnvironmentModel exists!
+     * Pending measurements are carried out before.
+     */
+    const std::vector<Sensor*>& getSensors() const;
+
+    /**
+     * Get preselection shared by sensors during their measurements
+     *
+     * \return preselection or nullptr outside of measurements or if disabled
      */
-    const std::vector<Sensor*>& getSensors() const { return mSensors; }
+    const SensorPreselection* getPreselection() const { return mPreselecting ? &mPreselection : nullptr; }
 
 private:
+    struct Expiry
+    {
+        omnetpp::SimTime last;
+        const EnvironmentModelObject* object;
+        int id;
+    };
+
     void initializeSensors();
+    void scheduleMeasurements();
+    void measurePendingSensors() const;
+    void prepareScheduledSensors() const;
+    void measureScheduledSensors() const;
+    void expireTrackings() const;
+    std::size_t getSensorSlot(const Sensor*);
+    void removeExpiredObjects(bool vanished) const;
 
     Middleware* mMiddleware;
     GlobalEnvironmentModel* mGlobalEnvironmentModel;
-    int mTrackingCounter = 0;
-    TrackedObjects mObjects;
-    std::vector<Sensor*> mSensors;
+    std::vector<const Sensor*> mTrackingSensors; /*< sensor of each tracking slot */
+    std::unordered_map<std::string, SensorMask> mCategoryMasks;
+    std::unordered_map<std::string, SensorMask> mNameMasks;
+    std::vector<Sensor*> mSensors; /*< sensor index matches its tracking slot */
+    omnetpp::SimTime mRefreshTime;
+    bool mFusedPreselection = true;
+
+    // tracked objects are a lazily measured view of the global model, thus updated by const accessors
+    mutable int mTrackingCounter = 0;
+    mutable TrackedObjects mObjects;
+    mutable std::vector<const EnvironmentModelObject*> mObjectKeys; /*< object address of each row */
+    mutable std::unordered_map<const EnvironmentModelObject*, std::size_t> mObjectRows;
+    mutable std::vector<std::deque<Expiry>> mExpiries; /*< per tracking slot, ordered by detection time */
+    mutable unsigned mObjectRemovalRevision = 0;
+    mutable std::vector<omnetpp::SimTime> mMeasurementTimes; /*< refresh time of each sensor's latest measurement */
+    mutable std::vector<bool> mPendingSensors; /*< sensors not measured since latest refresh */
+    mutable std::vector<std::size_t> mScheduledSensors; /*< sensors measured by current batch */
+    mutable bool mMeasuring = false;
+    mutable bool mPreselecting = false;
+    mutable SensorPreselection mPreselection;
 };
 
 using TrackedObjectsFilterPredicate = std::function<bool(const LocalEnvironmentModel::TrackedObject&)>;
 using TrackedObjectsFilterIterator = boost::filter_iterator<TrackedObjectsFilterPredicate, LocalEnvironmentModel::TrackedObjects::const_iterator>;
 using TrackedObjectsFilterRange = boost::iterator_range<TrackedObjectsFilterIterator>;
 
+TrackedObjectsFilterRange filterBySensorMask(const LocalEnvironmentModel::TrackedObjects&, LocalEnvironmentModel::SensorMask);
 TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel::TrackedObjects&, const std::string&);
 TrackedObjectsFilterRange filterBySensorName(const LocalEnvironmentModel::TrackedObjects&, const std::string&);
+TrackedObjectsFilterRange filterBySensorCategory(const LocalEnvironmentModel&, const std::string&);
+TrackedObjectsFilterRange filterBySensorName(const LocalEnvironmentModel&, const std::string&);
 
 } // namespace artery
 
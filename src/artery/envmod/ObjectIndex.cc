@@ -0,0 +1,297 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/ObjectIndex.h"
+#include "artery/envmod/EnvironmentModelObject.h"
+#include <boost/range/adaptor/transformed.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace artery
+{
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+namespace
+{
+
+geometry::Box envelope(const EnvironmentModelObject& object)
+{
+    return object.getCompactOutline().getBoundingBox();
+}
+
+geometry::Box inflate(const geometry::Box& box, double margin)
+{
+    geometry::Box inflated;
+    bg::set<bg::min_corner, 0>(inflated, bg::get<bg::min_corner, 0>(box) - margin);
+    bg::set<bg::min_corner, 1>(inflated, bg::get<bg::min_corner, 1>(box) - margin);
+    bg::set<bg::max_corner, 0>(inflated, bg::get<bg::max_corner, 0>(box) + margin);
+    bg::set<bg::max_corner, 1>(inflated, bg::get<bg::max_corner, 1>(box) + margin);
+    return inflated;
+}
+
+geometry::Polygon make_polygon(const std::vector<Position>& area)
+{
+    // Boost versions 1.60 and 1.61 do not compile R-tree queries with a ring of Positions
+    geometry::Polygon polygon;
+    bg::convert(area, polygon);
+    return polygon;
+}
+
+} // namespace
+
+std::unique_ptr<ObjectIndex> createObjectIndex(const std::string& type, double parameter)
+{
+    std::unique_ptr<ObjectIndex> index;
+    if (type == "rebuild") {
+        index.reset(new RebuildObjectIndex());
+    } else if (type == "incremental") {
+        index.reset(new IncrementalObjectIndex(parameter));
+    } else if (type == "grid") {
+        index.reset(new GridObjectIndex(parameter));
+    }
+    return index;
+}
+
+
+void RebuildObjectIndex::insert(const Object& object)
+{
+    mObjects.push_back(object);
+    mRtree.insert(RtreeValue { envelope(*object), object });
+}
+
+void RebuildObjectIndex::remove(const Object& object)
+{
+    auto found = std::find(mObjects.begin(), mObjects.end(), object);
+    if (found != mObjects.end()) {
+        *found = std::move(mObjects.back());
+        mObjects.pop_back();
+        mTainted = true; /*< pending rtree update */
+    }
+}
+
+void RebuildObjectIndex::update(const Object&)
+{
+    mTainted = true;
+}
+
+void RebuildObjectIndex::commit()
+{
+    if (mTainted) {
+        struct envelope_maker
+        {
+            inline RtreeValue operator()(const Object& object) const
+            {
+                return RtreeValue { envelope(*object), object };
+            }
+        };
+
+        // use bulk loading for efficient packing
+        mRtree = Rtree { mObjects | boost::adaptors::transformed(envelope_maker()) };
+        mTainted = false;
+    }
+}
+
+void RebuildObjectIndex::clear()
+{
+    mObjects.clear();
+    mRtree.clear();
+    mTainted = false;
+}
+
+void RebuildObjectIndex::query(const std::vector<Position>& area, const Visitor& visitor) const
+{
+    assert(!mTainted);
+    const geometry::Polygon polygon = make_polygon(area);
+    for (auto it = mRtree.qbegin(bgi::intersects(polygon)); it != mRtree.qend(); ++it) {
+        visitor(it->second);
+    }
+}
+
+
+IncrementalObjectIndex::IncrementalObjectIndex(double margin) : mMargin(margin)
+{
+}
+
+void IncrementalObjectIndex::insert(const Object& object)
+{
+    Entry& entry = mEntries[object.get()];
+    entry.object = object;
+    entry.actual = envelope(*object);
+    entry.fat = inflate(entry.actual, mMargin);
+    mRtree.insert(RtreeValue { entry.fat, &entry });
+}
+
+void IncrementalObjectIndex::remove(const Object& object)
+{
+    auto found = mEntries.find(object.get());
+    if (found != mEntries.end()) {
+        mRtree.remove(RtreeValue { found->second.fat, &found->second });
+        mEntries.erase(found);
+    }
+}
+
+void IncrementalObjectIndex::update(const Object& object)
+{
+    auto found = mEntries.find(object.get());
+    if (found != mEntries.end()) {
+        Entry& entry = found->second;
+        entry.actual = envelope(*object);
+        if (!bg::covered_by(entry.actual, entry.fat)) {
+            mRtree.remove(RtreeValue { entry.fat, &entry });
+            entry.fat = inflate(entry.actual, mMargin);
+            mRtree.insert(RtreeValue { entry.fat, &entry });
+        }
+    }
+}
+
+void IncrementalObjectIndex::clear()
+{
+    mRtree.clear();
+    mEntries.clear();
+}
+
+void IncrementalObjectIndex::query(const std::vector<Position>& area, const Visitor& visitor) const
+{
+    const geometry::Polygon polygon = make_polygon(area);
+    for (auto it = mRtree.qbegin(bgi::intersects(polygon)); it != mRtree.qend(); ++it) {
+        // fat box is only a coarse filter
+        const Entry* entry = it->second;
+        if (bg::intersects(polygon, entry->actual)) {
+            visitor(entry->object);
+        }
+    }
+}
+
+
+bool GridObjectIndex::CellRange::operator==(const CellRange& other) const
+{
+    return minX == other.minX && minY == other.minY && maxX == other.maxX && maxY == other.maxY;
+}
+
+GridObjectIndex::GridObjectIndex(double cellSize) : mCellSize(cellSize)
+{
+    assert(mCellSize > 0.0);
+}
+
+GridObjectIndex::CellKey GridObjectIndex::key(int x, int y)
+{
+    return (static_cast<CellKey>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+GridObjectIndex::CellRange GridObjectIndex::getCells(const geometry::Box& box) const
+{
+    CellRange range;
+    range.minX = std::floor(bg::get<bg::min_corner, 0>(box) / mCellSize);
+    range.minY = std::floor(bg::get<bg::min_corner, 1>(box) / mCellSize);
+    range.maxX = std::floor(bg::get<bg::max_corner, 0>(box) / mCellSize);
+    range.maxY = std::floor(bg::get<bg::max_corner, 1>(box) / mCellSize);
+    return range;
+}
+
+void GridObjectIndex::link(const Entry* entry)
+{
+    for (int x = entry->cells.minX; x <= entry->cells.maxX; ++x) {
+        for (int y = entry->cells.minY; y <= entry->cells.maxY; ++y) {
+            mCells[key(x, y)].push_back(entry);
+        }
+    }
+}
+
+void GridObjectIndex::unlink(const Entry* entry)
+{
+    for (int x = entry->cells.minX; x <= entry->cells.maxX; ++x) {
+        for (int y = entry->cells.minY; y <= entry->cells.maxY; ++y) {
+            auto cell = mCells.find(key(x, y));
+            if (cell != mCells.end()) {
+                auto& entries = cell->second;
+                auto found = std::find(entries.begin(), entries.end(), entry);
+                if (found != entries.end()) {
+                    *found = entries.back();
+                    entries.pop_back();
+                }
+                if (entries.empty()) {
+                    mCells.erase(cell);
+                }
+            }
+        }
+    }
+}
+
+void GridObjectIndex::insert(const Object& object)
+{
+    Entry& entry = mEntries[object.get()];
+    entry.object = object;
+    entry.box = envelope(*object);
+    entry.cells = getCells(entry.box);
+    entry.sequence = ++mSequence;
+    link(&entry);
+}
+
+void GridObjectIndex::remove(const Object& object)
+{
+    auto found = mEntries.find(object.get());
+    if (found != mEntries.end()) {
+        unlink(&found->second);
+        mEntries.erase(found);
+    }
+}
+
+void GridObjectIndex::update(const Object& object)
+{
+    auto found = mEntries.find(object.get());
+    if (found != mEntries.end()) {
+        Entry& entry = found->second;
+        entry.box = envelope(*object);
+        const CellRange cells = getCells(entry.box);
+        if (cells != entry.cells) {
+            unlink(&entry);
+            entry.cells = cells;
+            link(&entry);
+        }
+    }
+}
+
+void GridObjectIndex::clear()
+{
+    mCells.clear();
+    mEntries.clear();
+}
+
+void GridObjectIndex::query(const std::vector<Position>& area, const Visitor& visitor) const
+{
+    const geometry::Polygon polygon = make_polygon(area);
+    const CellRange cells = getCells(bg::return_envelope<geometry::Box>(polygon));
+    const unsigned visit = ++mVisit;
+    mFound.clear();
+
+    for (int x = cells.minX; x <= cells.maxX; ++x) {
+        for (int y = cells.minY; y <= cells.maxY; ++y) {
+            auto cell = mCells.find(key(x, y));
+            if (cell == mCells.end()) {
+                continue;
+            }
+
+            for (const Entry* entry : cell->second) {
+                if (entry->visit != visit) {
+                    entry->visit = visit;
+                    if (bg::intersects(polygon, entry->box)) {
+                        mFound.push_back(entry);
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(mFound.begin(), mFound.end(), [](const Entry* a, const Entry* b) { return a->sequence < b->sequence; });
+    for (const Entry* entry : mFound) {
+        visitor(entry->object);
+    }
+}
+
+} // namespace artery
@@ -0,0 +1,198 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_OBJECTINDEX_H_Q3VJ8RWE
+#define ENVMOD_OBJECTINDEX_H_Q3VJ8RWE
+
+#include "artery/envmod/Geometry.h"
+#include <boost/geometry/index/rtree.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace artery
+{
+
+class EnvironmentModelObject;
+
+/**
+ * ObjectIndex is a spatial index of the GlobalEnvironmentModel's dynamic objects
+ */
+class ObjectIndex
+{
+public:
+    using Object = std::shared_ptr<EnvironmentModelObject>;
+    using Visitor = std::function<void(const Object&)>;
+
+    virtual ~ObjectIndex() = default;
+
+    /**
+     * Add object to index
+     * \param object not yet indexed object
+     */
+    virtual void insert(const Object& object) = 0;
+
+    /**
+     * Remove object from index
+     * \param object indexed object
+     */
+    virtual void remove(const Object& object) = 0;
+
+    /**
+     * Notify index about a changed object outline
+     * \param object indexed object
+     */
+    virtual void update(const Object& object) = 0;
+
+    /**
+     * Complete a batch of updates, i.e. queries reflect all updates afterwards
+     */
+    virtual void commit() {}
+
+    /**
+     * Remove all objects from index
+     */
+    virtual void clear() = 0;
+
+    /**
+     * Visit all objects whose bounding box intersects the given area
+     * \param area search polygon
+     * \param visitor invoked once per found object
+     */
+    virtual void query(const std::vector<Position>& area, const Visitor& visitor) const = 0;
+
+    virtual std::size_t size() const = 0;
+};
+
+/**
+ * Create object index by its name
+ * \param type "rebuild", "incremental" or "grid"
+ * \param parameter margin of fat boxes (incremental) or cell size (grid) in meters
+ * \return object index or nullptr if type is unknown
+ */
+std::unique_ptr<ObjectIndex> createObjectIndex(const std::string& type, double parameter);
+
+/**
+ * R-tree bulk loaded from scratch whenever any object has changed
+ */
+class RebuildObjectIndex : public ObjectIndex
+{
+public:
+    void insert(const Object&) override;
+    void remove(const Object&) override;
+    void update(const Object&) override;
+    void commit() override;
+    void clear() override;
+    void query(const std::vector<Position>&, const Visitor&) const override;
+    std::size_t size() const override { return mObjects.size(); }
+
+private:
+    using RtreeValue = std::pair<geometry::Box, Object>;
+    using Rtree = boost::geometry::index::rtree<RtreeValue, boost::geometry::index::quadratic<16>>;
+
+    std::vector<Object> mObjects;
+    Rtree mRtree;
+    bool mTainted = false;
+};
+
+/**
+ * R-tree of inflated (fat) bounding boxes
+ *
+ * An object is only re-inserted when its actual bounding box leaves its fat box.
+ * Queries check candidates against their actual bounding box, i.e. results match RebuildObjectIndex.
+ */
+class IncrementalObjectIndex : public ObjectIndex
+{
+public:
+    /**
+     * \param margin inflation of bounding boxes on each side in meters
+     */
+    explicit IncrementalObjectIndex(double margin);
+
+    void insert(const Object&) override;
+    void remove(const Object&) override;
+    void update(const Object&) override;
+    void clear() override;
+    void query(const std::vector<Position>&, const Visitor&) const override;
+    std::size_t size() const override { return mEntries.size(); }
+
+private:
+    struct Entry
+    {
+        Object object;
+        geometry::Box fat;
+        geometry::Box actual;
+    };
+
+    using RtreeValue = std::pair<geometry::Box, const Entry*>;
+    using Rtree = boost::geometry::index::rtree<RtreeValue, boost::geometry::index::quadratic<16>>;
+
+    double mMargin;
+    // entries have stable addresses in unordered_map
+    std::unordered_map<const EnvironmentModelObject*, Entry> mEntries;
+    Rtree mRtree;
+};
+
+/**
+ * Uniform hash grid: objects are listed in every cell overlapped by their bounding box
+ *
+ * Cells are re-assigned only if an object's bounding box covers different cells after an update.
+ * This suits dense scenarios with many objects of similar size.
+ * Found objects are visited in insertion order, i.e. independent of the queried area.
+ */
+class GridObjectIndex : public ObjectIndex
+{
+public:
+    /**
+     * \param cellSize edge length of grid cells in meters
+     */
+    explicit GridObjectIndex(double cellSize);
+
+    void insert(const Object&) override;
+    void remove(const Object&) override;
+    void update(const Object&) override;
+    void clear() override;
+    void query(const std::vector<Position>&, const Visitor&) const override;
+    std::size_t size() const override { return mEntries.size(); }
+
+private:
+    struct CellRange
+    {
+        int minX, minY, maxX, maxY;
+        bool operator==(const CellRange&) const;
+        bool operator!=(const CellRange& other) const { return !(*this == other); }
+    };
+
+    struct Entry
+    {
+        Object object;
+        geometry::Box box;
+        CellRange cells;
+        std::uint64_t sequence = 0; /*< insertion order */
+        mutable unsigned visit = 0;
+    };
+
+    using CellKey = std::uint64_t;
+
+    CellRange getCells(const geometry::Box&) const;
+    void link(const Entry*);
+    void unlink(const Entry*);
+    static CellKey key(int x, int y);
+
+    double mCellSize;
+    std::unordered_map<const EnvironmentModelObject*, Entry> mEntries;
+    std::unordered_map<CellKey, std::vector<const Entry*>> mCells;
+    mutable unsigned mVisit = 0; /*< stamp to report objects spanning several cells only once */
+    std::uint64_t mSequence = 0;
+    mutable std::vector<const Entry*> mFound;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_OBJECTINDEX_H_Q3VJ8RWE */
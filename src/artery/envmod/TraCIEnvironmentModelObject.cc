@@ -113,6 +113,7 @@ void TraCIEnvironmentModelObject::update()
     boost::geometry::transform(squareCentrePoint, mCentrePoint, affine);
     mOutline.clear();
     boost::geometry::transform(squareOutline, mOutline, affine);
+    mCompactOutline.assign(mOutline);
     mAttachmentPoints.clear();
     boost::geometry::transform(squareAttachmentPoints, mAttachmentPoints, affine);
 }
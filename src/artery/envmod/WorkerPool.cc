@@ -0,0 +1,98 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/WorkerPool.h"
+#include <algorithm>
+
+namespace artery
+{
+
+WorkerPool::WorkerPool(unsigned threads)
+{
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (unsigned i = 1; i < threads; ++i) {
+        mWorkers.emplace_back(&WorkerPool::work, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWakeUp.notify_all();
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+void WorkerPool::run(std::size_t count, const Task& task)
+{
+    if (count == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTask = &task;
+        mCount = count;
+        mNext = 0;
+        mError = nullptr;
+        mBusy = mWorkers.size();
+        ++mBatch;
+    }
+    mWakeUp.notify_all();
+
+    process();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mFinished.wait(lock, [this] { return mBusy == 0; });
+    mTask = nullptr;
+    if (mError) {
+        std::rethrow_exception(mError);
+    }
+}
+
+void WorkerPool::work()
+{
+    unsigned batch = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWakeUp.wait(lock, [&] { return mStop || mBatch != batch; });
+            if (mStop) {
+                return;
+            }
+            batch = mBatch;
+        }
+
+        process();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (--mBusy == 0) {
+            mFinished.notify_one();
+        }
+    }
+}
+
+void WorkerPool::process()
+{
+    for (std::size_t index = mNext++; index < mCount; index = mNext++) {
+        try {
+            (*mTask)(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (!mError) {
+                mError = std::current_exception();
+            }
+        }
+    }
+}
+
+} // namespace artery
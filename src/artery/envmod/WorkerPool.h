@@ -0,0 +1,76 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_WORKERPOOL_H_E2RZN7UB
+#define ENVMOD_WORKERPOOL_H_E2RZN7UB
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * WorkerPool runs batches of independent tasks on a fixed set of threads
+ *
+ * Threads claim the next pending task of a batch when they become idle,
+ * i.e. tasks of varying costs are balanced dynamically among threads.
+ * The calling thread participates in processing each batch.
+ */
+class WorkerPool
+{
+public:
+    using Task = std::function<void(std::size_t)>;
+
+    /**
+     * \param threads total number of threads including the caller, 0 for hardware concurrency
+     */
+    explicit WorkerPool(unsigned threads);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Invoke task for every index in [0, count) and wait for completion
+     *
+     * If tasks throw, the first caught exception is re-thrown after all tasks have finished.
+     * \param count number of tasks
+     * \param task invoked with task index, concurrently for different indices
+     */
+    void run(std::size_t count, const Task& task);
+
+    /**
+     * Get total number of threads processing tasks
+     */
+    unsigned size() const { return mWorkers.size() + 1; }
+
+private:
+    void work();
+    void process();
+
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mWakeUp;
+    std::condition_variable mFinished;
+    const Task* mTask = nullptr;
+    std::size_t mCount = 0;
+    std::atomic<std::size_t> mNext { 0 };
+    unsigned mBatch = 0;
+    unsigned mBusy = 0;
+    bool mStop = false;
+    std::exception_ptr mError;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_WORKERPOOL_H_E2RZN7UB */
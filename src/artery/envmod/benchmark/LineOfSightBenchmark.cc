@@ -0,0 +1,153 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+/**
+ * Measure FovSensor's line-of-sight checks with and without CompactOutline separation tests.
+ *
+ * A sensor in the middle of a random urban scene checks all corners of all vehicles in its cone
+ * against all vehicles and buildings, i.e. like FovSensor::detectObjects without angular index.
+ * The exact boost::geometry predicates are evaluated either for all occluders or only for those
+ * not rejected by the compact outlines' separation tests. Both variants detect the same points.
+ *
+ * Usage: envmod_los_benchmark [vehicles] [buildings] [repetitions]
+ */
+
+#include "artery/envmod/CompactOutline.h"
+#include <boost/geometry/geometries/register/linestring.hpp>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using artery::CompactOutline;
+using artery::Position;
+using LineOfSight = std::array<Position, 2>;
+BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
+
+namespace bg = boost::geometry;
+
+namespace
+{
+
+using clock_type = std::chrono::steady_clock;
+
+struct Occluder
+{
+    explicit Occluder(std::vector<Position> outline) : outline(std::move(outline)), compact(this->outline) {}
+
+    std::vector<Position> outline;
+    CompactOutline compact;
+};
+
+std::vector<Position> createBox(double x, double y, double length, double width, double heading)
+{
+    std::vector<Position> box;
+    const double c = std::cos(heading);
+    const double s = std::sin(heading);
+    for (auto corner : { std::make_pair(-0.5, -0.5), std::make_pair(0.5, -0.5), std::make_pair(0.5, 0.5), std::make_pair(-0.5, 0.5) }) {
+        const double dx = corner.first * length;
+        const double dy = corner.second * width;
+        box.emplace_back(x + c * dx - s * dy, y + s * dx + c * dy);
+    }
+    bg::correct(box);
+    return box;
+}
+
+template<bool Compact>
+std::size_t detect(const Position& origin, const std::vector<Position>& cone,
+        const std::vector<Occluder>& vehicles, const std::vector<Occluder>& buildings)
+{
+    std::size_t visible = 0;
+    for (const Occluder& vehicle : vehicles) {
+        for (const Position& point : vehicle.outline) {
+            if (!bg::covered_by(point, cone)) {
+                continue;
+            }
+
+            const LineOfSight lineOfSight { origin, point };
+            auto blockedByVehicle = [&](const Occluder& other) {
+                return (!Compact || !other.compact.isSeparated(lineOfSight[0], lineOfSight[1])) &&
+                    bg::crosses(lineOfSight, other.outline);
+            };
+            auto blockedByBuilding = [&](const Occluder& building) {
+                return (!Compact || !building.compact.isSeparated(lineOfSight[0], lineOfSight[1])) &&
+                    bg::intersects(lineOfSight, building.outline);
+            };
+
+            if (std::none_of(vehicles.begin(), vehicles.end(), blockedByVehicle) &&
+                std::none_of(buildings.begin(), buildings.end(), blockedByBuilding)) {
+                ++visible;
+            }
+        }
+    }
+    return visible;
+}
+
+template<bool Compact>
+double measure(const Position& origin, const std::vector<Position>& cone,
+        const std::vector<Occluder>& vehicles, const std::vector<Occluder>& buildings,
+        int repetitions, std::size_t& visible)
+{
+    const auto start = clock_type::now();
+    for (int rep = 0; rep < repetitions; ++rep) {
+        visible = detect<Compact>(origin, cone, vehicles, buildings);
+    }
+    return std::chrono::duration<double, std::milli>(clock_type::now() - start).count() / repetitions;
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    const int numVehicles = argc > 1 ? std::atoi(argv[1]) : 100;
+    const int numBuildings = argc > 2 ? std::atoi(argv[2]) : 50;
+    const int repetitions = argc > 3 ? std::atoi(argv[3]) : 20;
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coordinate(-150.0, 150.0);
+    std::uniform_real_distribution<double> heading(0.0, 2.0 * M_PI);
+    std::uniform_real_distribution<double> extent(5.0, 20.0);
+
+    const Position origin(0.0, 0.0);
+    std::vector<Occluder> buildings;
+    while (buildings.size() < static_cast<std::size_t>(numBuildings)) {
+        auto outline = createBox(coordinate(rng), coordinate(rng), extent(rng), extent(rng), heading(rng));
+        if (!bg::covered_by(origin, outline)) {
+            buildings.emplace_back(std::move(outline));
+        }
+    }
+    std::vector<Occluder> vehicles;
+    for (int i = 0; i < numVehicles; ++i) {
+        vehicles.emplace_back(createBox(coordinate(rng), coordinate(rng), 4.5, 1.8, heading(rng)));
+    }
+
+    // omnidirectional sensor cone of 150 m range
+    std::vector<Position> cone;
+    for (int i = 0; i < 24; ++i) {
+        const double angle = 2.0 * M_PI * i / 24;
+        cone.emplace_back(150.0 * std::cos(angle), 150.0 * std::sin(angle));
+    }
+    bg::correct(cone);
+
+    std::size_t visibleExact = 0;
+    std::size_t visibleCompact = 0;
+    const double exact = measure<false>(origin, cone, vehicles, buildings, repetitions, visibleExact);
+    const double compact = measure<true>(origin, cone, vehicles, buildings, repetitions, visibleCompact);
+    if (visibleExact != visibleCompact) {
+        std::cerr << "detections differ: " << visibleExact << " vs. " << visibleCompact << " visible points" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << numVehicles << " vehicles, " << numBuildings << " buildings, " << visibleExact << " visible points\n"
+        << std::fixed << std::setprecision(3)
+        << std::setw(18) << "exact only: " << exact << " ms per detection\n"
+        << std::setw(18) << "compact outline: " << compact << " ms per detection, speedup "
+        << std::setprecision(2) << exact / compact << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,141 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/AngularOcclusionIndex.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace artery
+{
+
+namespace
+{
+
+// tolerances absorbing rounding errors, they only enlarge the candidate sets
+const double angleTolerance = 1e-6; /*< radian */
+const double distanceTolerance = 1e-6; /*< meter */
+
+double distanceToSegment(double px, double py, double ax, double ay, double bx, double by)
+{
+    const double dx = bx - ax;
+    const double dy = by - ay;
+    const double length2 = dx * dx + dy * dy;
+    double t = 0.0;
+    if (length2 > 0.0) {
+        t = std::max(0.0, std::min(1.0, ((px - ax) * dx + (py - ay) * dy) / length2));
+    }
+    return std::hypot(ax + t * dx - px, ay + t * dy - py);
+}
+
+} // namespace
+
+AngularOcclusionIndex::AngularOcclusionIndex(unsigned sectors) :
+    mSectorWidth(2.0 * M_PI / sectors), mSectors(sectors)
+{
+    assert(sectors > 0);
+}
+
+void AngularOcclusionIndex::reset(const Position& origin)
+{
+    mOriginX = origin.x.value();
+    mOriginY = origin.y.value();
+    for (auto& sector : mSectors) {
+        sector.clear();
+    }
+    mDistances.clear();
+}
+
+void AngularOcclusionIndex::add(const CompactOutline& outline)
+{
+    const std::size_t occluder = mDistances.size();
+    mDistances.push_back(std::numeric_limits<double>::infinity());
+    if (outline.empty()) {
+        return;
+    }
+
+    // walk along outline (including closing edge) and track the unwrapped angle of its vertices
+    double distance = std::numeric_limits<double>::infinity();
+    const std::size_t count = outline.size();
+    const double* vertexX = outline.x().data();
+    const double* vertexY = outline.y().data();
+    double prevX = vertexX[count - 1] - mOriginX;
+    double prevY = vertexY[count - 1] - mOriginY;
+    double prevAngle = std::atan2(prevY, prevX);
+    const double startAngle = prevAngle;
+    double angle = prevAngle;
+    double minAngle = angle;
+    double maxAngle = angle;
+    for (std::size_t i = 0; i < count; ++i) {
+        const double x = vertexX[i] - mOriginX;
+        const double y = vertexY[i] - mOriginY;
+        const double vertexAngle = std::atan2(y, x);
+        distance = std::min(distance, distanceToSegment(0.0, 0.0, prevX, prevY, x, y));
+        angle += std::remainder(vertexAngle - prevAngle, 2.0 * M_PI);
+        minAngle = std::min(minAngle, angle);
+        maxAngle = std::max(maxAngle, angle);
+        prevX = x;
+        prevY = y;
+        prevAngle = vertexAngle;
+    }
+
+    // accumulated angle is a multiple of 2 pi if the outline winds around the origin
+    const bool enclosed = std::abs(angle - startAngle) > M_PI;
+    if (enclosed || distance <= distanceTolerance) {
+        mDistances[occluder] = 0.0;
+        linkAll(occluder);
+    } else {
+        mDistances[occluder] = distance;
+        link(occluder, minAngle - angleTolerance, maxAngle + angleTolerance);
+    }
+}
+
+void AngularOcclusionIndex::candidates(const Position& target, std::vector<std::size_t>& candidates) const
+{
+    candidates.clear();
+    const double x = target.x.value() - mOriginX;
+    const double y = target.y.value() - mOriginY;
+    const double range = std::hypot(x, y) + distanceTolerance;
+    for (std::size_t occluder : mSectors[sector(std::atan2(y, x))]) {
+        if (mDistances[occluder] <= range) {
+            candidates.push_back(occluder);
+        }
+    }
+}
+
+std::size_t AngularOcclusionIndex::sector(double angle) const
+{
+    return wrap(std::floor(angle / mSectorWidth));
+}
+
+std::size_t AngularOcclusionIndex::wrap(long index) const
+{
+    const long count = mSectors.size();
+    return ((index % count) + count) % count;
+}
+
+void AngularOcclusionIndex::link(std::size_t occluder, double from, double to)
+{
+    const long first = std::floor(from / mSectorWidth);
+    const long last = std::floor(to / mSectorWidth);
+    if (last - first + 1 >= static_cast<long>(mSectors.size())) {
+        linkAll(occluder);
+    } else {
+        for (long index = first; index <= last; ++index) {
+            mSectors[wrap(index)].push_back(occluder);
+        }
+    }
+}
+
+void AngularOcclusionIndex::linkAll(std::size_t occluder)
+{
+    for (auto& sector : mSectors) {
+        sector.push_back(occluder);
+    }
+}
+
+} // namespace artery
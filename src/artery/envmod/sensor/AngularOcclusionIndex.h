@@ -0,0 +1,70 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_ANGULAROCCLUSIONINDEX_H_T6PW2KXN
+#define ENVMOD_ANGULAROCCLUSIONINDEX_H_T6PW2KXN
+
+#include "artery/envmod/CompactOutline.h"
+#include "artery/utility/Geometry.h"
+#include <cstddef>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * AngularOcclusionIndex sorts occluders into angular sectors around a sensor origin
+ *
+ * Each occluder is listed in all sectors covered by its outline as seen from the origin.
+ * A line of sight towards a point can only be blocked by occluders in the point's sector
+ * which are not farther away than the point itself. Candidates are a conservative superset,
+ * i.e. exact intersection tests are still required but only for a few occluders.
+ */
+class AngularOcclusionIndex
+{
+public:
+    /**
+     * \param sectors number of equally sized sectors covering the full circle
+     */
+    explicit AngularOcclusionIndex(unsigned sectors = 720);
+
+    /**
+     * Remove all occluders and move origin
+     * \param origin common start point of all lines of sight
+     */
+    void reset(const Position& origin);
+
+    /**
+     * Add an occluder, occluders are numbered consecutively starting at 0
+     * \param outline occluder's polygon
+     */
+    void add(const CompactOutline& outline);
+
+    /**
+     * Find occluders possibly intersecting the line of sight from origin to target
+     * \param target end point of line of sight
+     * \param candidates filled with occluder numbers in ascending order
+     */
+    void candidates(const Position& target, std::vector<std::size_t>& candidates) const;
+
+    std::size_t size() const { return mDistances.size(); }
+
+private:
+    std::size_t sector(double angle) const;
+    std::size_t wrap(long index) const;
+    void link(std::size_t occluder, double from, double to);
+    void linkAll(std::size_t occluder);
+
+    double mSectorWidth;
+    double mOriginX = 0.0;
+    double mOriginY = 0.0;
+    std::vector<std::vector<std::size_t>> mSectors;
+    std::vector<double> mDistances; /*< minimum distance between origin and occluders */
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_ANGULAROCCLUSIONINDEX_H_T6PW2KXN */
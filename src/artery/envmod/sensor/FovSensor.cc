@@ -8,9 +8,16 @@
 #include "artery/envmod/GlobalEnvironmentModel.h"
 #include "artery/envmod/sensor/FovSensor.h"
 #include "artery/envmod/sensor/SensorDetection.h"
+#include "artery/envmod/sensor/SensorPreselection.h"
 #include "artery/envmod/LocalEnvironmentModel.h"
 #include "artery/envmod/EnvironmentModelObstacle.h"
+#include <boost/functional/hash.hpp>
 #include <boost/geometry/geometries/register/linestring.hpp>
+#include <unistd.h>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 #include <unordered_set>
 
 using namespace omnetpp;
@@ -63,19 +70,65 @@ void FovSensor::initialize()
     mFovConfig.fieldOfView.angle = par("fovAngle").doubleValue() * boost::units::degree::degrees;
     mFovConfig.numSegments = par("numSegments");
     mFovConfig.doLineOfSightCheck = par("doLineOfSightCheck");
+    mFovConfig.useAngularOcclusionIndex = par("angularOcclusionIndex");
+    mUpdatePeriod = par("updatePeriod");
 
     initializeVisualization();
 }
 
+void FovSensor::prepareMeasurement(SensorPreselection& preselection)
+{
+    Enter_Method_Silent();
+    mPreparedDetection = createSensorCone();
+    mPreparedDetectionComputed = false;
+    preselection.include(mPreparedDetection->sensorCone);
+    if (mFovConfig.doLineOfSightCheck && !isObstacleCacheValid(*mPreparedDetection)) {
+        if (mStaticVisibility) {
+            // computeMeasurement may run on worker threads: build (or load) region on main thread
+            const Obstacles& obstacles = preselectObstacles(*mPreparedDetection, nullptr);
+            getVisibilityRegion(*mPreparedDetection, obstacles);
+        } else {
+            preselection.requestObstacles();
+        }
+    }
+}
+
+void FovSensor::computeMeasurement()
+{
+    const SensorPreselection* preselection = mLocalEnvironmentModel->getPreselection();
+    if (preselection && mPreparedDetection && !mPreparedDetectionComputed) {
+        detectObjects(*mPreparedDetection, preselection);
+        mPreparedDetectionComputed = true;
+    }
+}
+
 void FovSensor::measurement()
 {
     Enter_Method("measurement");
-    auto detection = detectObjects();
+    SensorDetection detection;
+    const SensorPreselection* preselection = mLocalEnvironmentModel->getPreselection();
+    if (preselection && mPreparedDetection) {
+        detection = std::move(*mPreparedDetection);
+        if (!mPreparedDetectionComputed) {
+            detectObjects(detection, preselection);
+        }
+    } else {
+        detection = detectObjects();
+    }
+    mPreparedDetection = boost::none;
+    mPreparedDetectionComputed = false;
     mLocalEnvironmentModel->complementObjects(detection, *this);
     mLastDetection = std::move(detection);
 }
 
 SensorDetection FovSensor::detectObjects() const
+{
+    SensorDetection detection = createSensorCone();
+    detectObjects(detection, nullptr);
+    return detection;
+}
+
+void FovSensor::detectObjects(SensorDetection& detection, const SensorPreselection* preselection) const
 {
     namespace bg = boost::geometry;
     if (mFovConfig.fieldOfView.range <= 0.0 * boost::units::si::meter) {
@@ -84,15 +137,37 @@ SensorDetection FovSensor::detectObjects() const
         throw std::runtime_error("sensor opening angle exceeds 360 degree");
     }
 
-    SensorDetection detection = createSensorCone();
-    auto preselObjectsInSensorRange = mGlobalEnvironmentModel->preselectObjects(mFovConfig.egoID, detection.sensorCone);
-
-    // get obstacles intersecting with sensor cone
-    auto obstacleIntersections = mGlobalEnvironmentModel->preselectObstacles(detection.sensorCone);
+    auto preselObjectsInSensorRange = preselection ?
+        preselection->selectObjects(detection.sensorCone) :
+        mGlobalEnvironmentModel->preselectObjects(mFovConfig.egoID, detection.sensorCone);
 
     if (mFovConfig.doLineOfSightCheck)
     {
+        // get obstacles intersecting with sensor cone
+        const Obstacles& obstacleIntersections = preselectObstacles(detection, preselection);
+
         std::unordered_set<std::shared_ptr<EnvironmentModelObstacle>> blockingObstacles;
+        const bool useIndex = mFovConfig.useAngularOcclusionIndex;
+        if (useIndex) {
+            mObjectOcclusion.reset(detection.sensorOrigin);
+            for (const auto& object : preselObjectsInSensorRange) {
+                mObjectOcclusion.add(object->getCompactOutline());
+            }
+            // obstacle index persists as long as cached obstacles are valid, e.g. for stationary sensors
+            if (!mObstacleCache.indexed) {
+                mObstacleOcclusion.reset(detection.sensorOrigin);
+                for (const auto& obstacle : obstacleIntersections) {
+                    ASSERT(obstacle);
+                    mObstacleOcclusion.add(obstacle->getCompactOutline());
+                }
+                mObstacleCache.indexed = true;
+            }
+        }
+
+        const VisibilityRegion* visibility = nullptr;
+        if (mStaticVisibility) {
+            visibility = &getVisibilityRegion(detection, obstacleIntersections);
+        }
 
         // check if objects in sensor cone are hidden by another object or an obstacle
         for (const auto& object : preselObjectsInSensorRange)
@@ -108,23 +183,60 @@ SensorDetection FovSensor::detectObjects() const
                 lineOfSight[0] = detection.sensorOrigin;
                 lineOfSight[1] = objectPoint;
 
-                bool noVehicleOccultation = std::none_of(preselObjectsInSensorRange.begin(), preselObjectsInSensorRange.end(),
-                        [&](const std::shared_ptr<EnvironmentModelObject>& object) {
-                            return bg::crosses(lineOfSight, object->getOutline());
-                        });
-
-                bool noObstacleOccultation = std::none_of(obstacleIntersections.begin(), obstacleIntersections.end(),
-                        [&](const std::shared_ptr<EnvironmentModelObstacle>& obstacle) {
-                            ASSERT(obstacle);
-                            if (bg::intersects(lineOfSight, obstacle->getOutline())) {
-                                blockingObstacles.insert(obstacle);
-                                return true;
-                            } else {
-                                return false;
-                            }
-                        });
-
-                if (noVehicleOccultation && noObstacleOccultation) {
+                // compact outlines reject most occluders before exact tests
+                auto blockedByObject = [&](const std::shared_ptr<EnvironmentModelObject>& object) {
+                    return !object->getCompactOutline().isSeparated(lineOfSight[0], lineOfSight[1]) &&
+                        bg::crosses(lineOfSight, object->getOutline());
+                };
+
+                auto blockedByObstacle = [&](const std::shared_ptr<EnvironmentModelObstacle>& obstacle) {
+                    ASSERT(obstacle);
+                    if (!obstacle->getCompactOutline().isSeparated(lineOfSight[0], lineOfSight[1]) &&
+                        bg::intersects(lineOfSight, obstacle->getOutline())) {
+                        blockingObstacles.insert(obstacle);
+                        return true;
+                    } else {
+                        return false;
+                    }
+                };
+
+                auto noVehicleOccultation = [&]() {
+                    if (useIndex) {
+                        // same tests as below but only for occluders in direction of object point
+                        mObjectOcclusion.candidates(objectPoint, mOcclusionCandidates);
+                        return std::none_of(mOcclusionCandidates.begin(), mOcclusionCandidates.end(),
+                                [&](std::size_t i) { return blockedByObject(preselObjectsInSensorRange[i]); });
+                    } else {
+                        return std::none_of(preselObjectsInSensorRange.begin(), preselObjectsInSensorRange.end(), blockedByObject);
+                    }
+                };
+
+                auto noObstacleOccultation = [&]() {
+                    if (useIndex) {
+                        mObstacleOcclusion.candidates(objectPoint, mOcclusionCandidates);
+                        return std::none_of(mOcclusionCandidates.begin(), mOcclusionCandidates.end(),
+                                [&](std::size_t i) { return blockedByObstacle(obstacleIntersections[i]); });
+                    } else {
+                        return std::none_of(obstacleIntersections.begin(), obstacleIntersections.end(), blockedByObstacle);
+                    }
+                };
+
+                bool visible = false;
+                if (visibility) {
+                    if (visibility->isVisible(objectPoint)) {
+                        visible = noVehicleOccultation();
+                    } else {
+                        // hidden by obstacles anyway, only look up the blocking one
+                        noObstacleOccultation();
+                    }
+                } else {
+                    // both tests contribute to blocking obstacles
+                    const bool noVehicle = noVehicleOccultation();
+                    const bool noObstacle = noObstacleOccultation();
+                    visible = noVehicle && noObstacle;
+                }
+
+                if (visible) {
                     if (detection.objects.empty() || detection.objects.back() != object) {
                         detection.objects.push_back(object);
                     }
@@ -141,22 +253,105 @@ SensorDetection FovSensor::detectObjects() const
 
         detection.obstacles.assign(blockingObstacles.begin(), blockingObstacles.end());
     } else {
+        const CompactOutline sensorCone { detection.sensorCone };
         for (const auto& object : preselObjectsInSensorRange) {
             // preselection: object's bounding box and sensor cone's bounding box intersect
             // now: check if their actual geometries intersect somewhere
-            if (bg::intersects(object->getOutline(), detection.sensorCone)) {
+            if (!sensorCone.isSeparated(object->getCompactOutline()) &&
+                bg::intersects(object->getOutline(), detection.sensorCone)) {
                 detection.objects.push_back(object);
             }
         }
     }
+}
 
-    return detection;
+const FovSensor::Obstacles& FovSensor::preselectObstacles(const SensorDetection& detection, const SensorPreselection* preselection) const
+{
+    ObstacleCache& cache = mObstacleCache;
+    if (!isObstacleCacheValid(detection)) {
+        cache.obstacles = preselection ?
+            preselection->selectObstacles(detection.sensorCone) :
+            mGlobalEnvironmentModel->preselectObstacles(detection.sensorCone);
+        cache.revision = mGlobalEnvironmentModel->getObstacleRevision();
+        cache.sensorOrigin = detection.sensorOrigin;
+        cache.sensorCone = detection.sensorCone;
+        cache.indexed = false;
+        cache.visibility = boost::none;
+        cache.valid = true;
+    }
+    return cache.obstacles;
+}
+
+bool FovSensor::isObstacleCacheValid(const SensorDetection& detection) const
+{
+    const ObstacleCache& cache = mObstacleCache;
+    return cache.valid && cache.revision == mGlobalEnvironmentModel->getObstacleRevision() &&
+        cache.sensorOrigin == detection.sensorOrigin && cache.sensorCone == detection.sensorCone;
+}
+
+const VisibilityRegion& FovSensor::getVisibilityRegion(const SensorDetection& detection, const Obstacles& obstacles) const
+{
+    ObstacleCache& cache = mObstacleCache;
+    if (cache.visibility) {
+        return *cache.visibility;
+    }
+
+    cache.visibility.emplace(detection.sensorOrigin, detection.sensorCone);
+    std::string path;
+    if (!mVisibilityCache.empty()) {
+        // regions are only reusable for identical sensor pose and obstacles
+        std::size_t key = 0;
+        auto hashPosition = [](std::size_t& seed, const Position& pos) {
+            boost::hash_combine(seed, pos.x.value());
+            boost::hash_combine(seed, pos.y.value());
+        };
+        hashPosition(key, detection.sensorOrigin);
+        for (const Position& point : detection.sensorCone) {
+            hashPosition(key, point);
+        }
+        std::size_t obstacleKey = 0;
+        for (const auto& obstacle : obstacles) {
+            // order of preselected obstacles is irrelevant
+            std::size_t seed = std::hash<std::string> {}(obstacle->getObstacleId());
+            for (const Position& point : obstacle->getOutline()) {
+                hashPosition(seed, point);
+            }
+            obstacleKey += seed;
+        }
+        boost::hash_combine(key, obstacleKey);
+
+        std::ostringstream filename;
+        filename << mVisibilityCache << "/visibility-" << std::hex << std::setw(16) << std::setfill('0') << key << ".wkt";
+        path = filename.str();
+
+        std::ifstream stored(path);
+        if (stored && cache.visibility->read(stored)) {
+            return *cache.visibility;
+        }
+    }
+
+    for (const auto& obstacle : obstacles) {
+        cache.visibility->occlude(obstacle->getOutline());
+    }
+
+    if (!path.empty()) {
+        // concurrent runs may store the same region, rename replaces it atomically
+        const std::string tmpPath = path + "." + std::to_string(::getpid());
+        std::ofstream output(tmpPath);
+        cache.visibility->write(output);
+        output.close();
+        if (!output || std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+            EV_WARN << "cannot store visibility region at " << path << "\n";
+            std::remove(tmpPath.c_str());
+        }
+    }
+    return *cache.visibility;
 }
 
 SensorDetection FovSensor::createSensorCone() const
 {
     SensorDetection detection;
-    const auto& egoObj = mGlobalEnvironmentModel->getObject(mFovConfig.egoID);
+    const auto egoObj = getEgoObject();
     if (egoObj) {
         detection.sensorOrigin = egoObj->getAttachmentPoint(mFovConfig.sensorPosition);
         detection.sensorCone = createSensorArc(mFovConfig, *egoObj);
@@ -208,6 +403,12 @@ void FovSensor::initializeVisualization()
     }
 }
 
+std::shared_ptr<EnvironmentModelObject> FovSensor::getEgoObject() const
+{
+    const SensorPreselection* preselection = mLocalEnvironmentModel->getPreselection();
+    return preselection ? preselection->getEgo() : mGlobalEnvironmentModel->getObject(mFovConfig.egoID);
+}
+
 const FieldOfView& FovSensor::getFieldOfView() const
 {
     return mFovConfig.fieldOfView;
@@ -219,6 +420,11 @@ omnetpp::SimTime FovSensor::getValidityPeriod() const
     return SimTime { 200, SIMTIME_MS };
 }
 
+omnetpp::SimTime FovSensor::getUpdatePeriod() const
+{
+    return mUpdatePeriod;
+}
+
 SensorPosition FovSensor::position() const
 {
     return mFovConfig.sensorPosition;
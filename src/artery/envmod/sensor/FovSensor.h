@@ -7,9 +7,12 @@
 #ifndef ENVMOD_FOVRSENSOR_H_BCY7WDMB
 #define ENVMOD_FOVRSENSOR_H_BCY7WDMB
 
+#include "artery/envmod/sensor/AngularOcclusionIndex.h"
 #include "artery/envmod/sensor/SensorConfiguration.h"
 #include "artery/envmod/sensor/SensorDetection.h"
 #include "artery/envmod/sensor/BaseSensor.h"
+#include "artery/envmod/sensor/VisibilityRegion.h"
+#include <boost/optional/optional.hpp>
 #include <omnetpp/ccanvas.h>
 #include <memory>
 #include <functional>
@@ -22,10 +25,13 @@ class FovSensor : public BaseSensor
 public:
     FovSensor();
 
+    void prepareMeasurement(SensorPreselection&) override;
+    void computeMeasurement() override;
     void measurement() override;
     const FieldOfView& getFieldOfView() const;
     SensorPosition position() const override;
     omnetpp::SimTime getValidityPeriod() const override;
+    omnetpp::SimTime getUpdatePeriod() const override;
     const std::string& getSensorCategory() const override;
     const std::string getSensorName() const override;
     void setSensorName(const std::string& name) override;
@@ -52,17 +58,74 @@ protected:
     void refreshDisplay() const override;
     virtual SensorDetection createSensorCone() const;
 
+    /**
+     * Get ego object, shared preselection avoids repeated look-ups
+     * \return ego object or nullptr
+     */
+    std::shared_ptr<EnvironmentModelObject> getEgoObject() const;
+
+    /**
+     * Detect objects within sensor cone
+     * \param detection sensor cone and origin, detected objects and obstacles are added
+     * \param preselection shared candidates, own preselection queries are issued if nullptr
+     */
+    void detectObjects(SensorDetection& detection, const SensorPreselection* preselection) const;
+
     SensorConfigFov mFovConfig;
     Updatable<SensorDetection> mLastDetection;
     bool mDrawLinesOfSight;
+    omnetpp::SimTime mUpdatePeriod;
+    bool mStaticVisibility = false; /*< precompute region not shadowed by obstacles, stationary sensors only */
+    std::string mVisibilityCache; /*< directory storing precomputed regions, empty for no storage */
 
 private:
+    using Obstacles = std::vector<std::shared_ptr<EnvironmentModelObstacle>>;
+
+    /**
+     * Obstacles are static, i.e. their preselection only changes if the sensor cone moves
+     * \param detection detection providing sensor cone
+     * \param preselection shared candidates (optional)
+     * \return obstacles intersecting sensor cone
+     */
+    const Obstacles& preselectObstacles(const SensorDetection& detection, const SensorPreselection* preselection) const;
+    bool isObstacleCacheValid(const SensorDetection& detection) const;
+
+    /**
+     * Get region not shadowed by obstacles, it is computed at most once per valid obstacle cache
+     *
+     * Computing the region may access the file system and log, i.e. it is not thread-safe:
+     * prepareMeasurement computes it on the main thread before computeMeasurement runs.
+     * \param detection detection providing sensor cone
+     * \param obstacles preselected obstacles intersecting sensor cone
+     * \return visibility region
+     */
+    const VisibilityRegion& getVisibilityRegion(const SensorDetection& detection, const Obstacles& obstacles) const;
+
+    struct ObstacleCache
+    {
+        bool valid = false;
+        unsigned revision = 0; /*< obstacle database revision */
+        Position sensorOrigin;
+        std::vector<Position> sensorCone;
+        Obstacles obstacles;
+        bool indexed = false; /*< mObstacleOcclusion refers to cached obstacles */
+        boost::optional<VisibilityRegion> visibility;
+    };
+
+    boost::optional<SensorDetection> mPreparedDetection;
+    bool mPreparedDetectionComputed = false;
     omnetpp::cFigure::Color mColor;
     omnetpp::cGroupFigure* mGroupFigure;
     omnetpp::cPolygonFigure* mSensorConeFigure;
     omnetpp::cGroupFigure* mLinesOfSightFigure;
     omnetpp::cGroupFigure* mObjectsFigure;
     omnetpp::cGroupFigure* mObstaclesFigure;
+
+    // scratch space of line-of-sight checks, kept across measurements to avoid allocations
+    mutable AngularOcclusionIndex mObjectOcclusion;
+    mutable AngularOcclusionIndex mObstacleOcclusion;
+    mutable std::vector<std::size_t> mOcclusionCandidates;
+    mutable ObstacleCache mObstacleCache;
 };
 
 } // namespace artery
@@ -16,6 +16,8 @@ void RsuFovSensor::initialize()
 {
     FovSensor::initialize();
     mFovHeading = Angle::from_degree(par("fovHeading"));
+    mStaticVisibility = par("staticVisibility");
+    mVisibilityCache = par("visibilityCache").stdstringValue();
 }
 
 SensorDetection RsuFovSensor::createSensorCone() const
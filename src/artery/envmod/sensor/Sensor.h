@@ -17,13 +17,39 @@
 namespace artery
 {
 
+class SensorPreselection;
+
 class Sensor : public omnetpp::cSimpleModule
 {
 public:
     virtual ~Sensor() = default;
+
+    /**
+     * Announce area of interest of upcoming measurement
+     * \param preselection shared by all sensors of a local environment model
+     */
+    virtual void prepareMeasurement(SensorPreselection&) {}
+
+    /**
+     * Compute detection of prepared measurement ahead of measurement()
+     *
+     * This method may run on a worker thread concurrently to other sensors' computations.
+     * Hence, it must neither change simulation state nor access other modules.
+     */
+    virtual void computeMeasurement() {}
+
     virtual void measurement() = 0;
     virtual SensorPosition position() const = 0;
     virtual omnetpp::SimTime getValidityPeriod() const = 0;
+
+    /**
+     * Get period of measurements carried out without any access to the local environment model
+     *
+     * Zero period means a measurement at each refresh of the global environment model.
+     * Otherwise, accesses to the local environment model trigger pending measurements in between.
+     * \return update period
+     */
+    virtual omnetpp::SimTime getUpdatePeriod() const { return omnetpp::SimTime::ZERO; }
     virtual const std::string& getSensorCategory() const = 0;
     virtual const std::string getSensorName() const = 0;
     virtual void setSensorName(const std::string& name) = 0;
@@ -30,6 +30,7 @@ struct SensorConfigFov : public SensorConfig
         SensorPosition sensorPosition = SensorPosition::FRONT;
         unsigned numSegments = 0; /*< number of sensor cone segments (0 build a triangle) */
         bool doLineOfSightCheck = true; /*< false for simple "object in sensor cone" tests */
+        bool useAngularOcclusionIndex = true; /*< test lines of sight only against occluders in their direction */
 };
 
 
@@ -0,0 +1,121 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/SensorPreselection.h"
+#include "artery/envmod/EnvironmentModelObject.h"
+#include "artery/envmod/EnvironmentModelObstacle.h"
+#include "artery/envmod/GlobalEnvironmentModel.h"
+#include <cassert>
+
+namespace artery
+{
+
+namespace bg = boost::geometry;
+
+void SensorPreselection::reset(GlobalEnvironmentModel* global, const std::string& ego)
+{
+    assert(global);
+    mGlobal = global;
+    mEgoId = ego;
+    mEgo = ego.empty() ? nullptr : mGlobal->getObject(ego);
+    mEmpty = true;
+    mObstaclesRequested = false;
+    mObjectsQueried = false;
+    mObstaclesQueried = false;
+    mObjects.clear();
+    mObstacles.clear();
+}
+
+void SensorPreselection::include(const std::vector<Position>& area)
+{
+    assert(!mObjectsQueried && !mObstaclesQueried);
+    const geometry::Box box = bg::return_envelope<geometry::Box>(area);
+    if (mEmpty) {
+        mEnvelope = box;
+        mEmpty = false;
+    } else {
+        bg::expand(mEnvelope, box);
+    }
+}
+
+std::vector<Position> SensorPreselection::envelopeArea() const
+{
+    const double minX = bg::get<bg::min_corner, 0>(mEnvelope);
+    const double minY = bg::get<bg::min_corner, 1>(mEnvelope);
+    const double maxX = bg::get<bg::max_corner, 0>(mEnvelope);
+    const double maxY = bg::get<bg::max_corner, 1>(mEnvelope);
+    std::vector<Position> area {
+        Position { minX, minY }, Position { minX, maxY }, Position { maxX, maxY }, Position { maxX, minY }
+    };
+    bg::correct(area);
+    return area;
+}
+
+void SensorPreselection::fetch()
+{
+    queryObjects();
+    if (mObstaclesRequested) {
+        queryObstacles();
+    }
+}
+
+void SensorPreselection::queryObjects() const
+{
+    assert(mGlobal);
+    if (!mObjectsQueried) {
+        if (!mEmpty) {
+            for (auto& object : mGlobal->preselectObjects(mEgoId, envelopeArea())) {
+                mObjects.emplace_back(object->getCompactOutline().getBoundingBox(), std::move(object));
+            }
+        }
+        mObjectsQueried = true;
+    }
+}
+
+void SensorPreselection::queryObstacles() const
+{
+    assert(mGlobal);
+    if (!mObstaclesQueried) {
+        if (!mEmpty) {
+            for (auto& obstacle : mGlobal->preselectObstacles(envelopeArea())) {
+                mObstacles.emplace_back(obstacle->getCompactOutline().getBoundingBox(), std::move(obstacle));
+            }
+        }
+        mObstaclesQueried = true;
+    }
+}
+
+SensorPreselection::Objects SensorPreselection::selectObjects(const std::vector<Position>& area) const
+{
+    queryObjects();
+
+    // same predicate as object index queries
+    geometry::Polygon polygon;
+    bg::convert(area, polygon);
+
+    Objects objects;
+    for (const auto& candidate : mObjects) {
+        if (bg::intersects(polygon, candidate.first)) {
+            objects.push_back(candidate.second);
+        }
+    }
+    return objects;
+}
+
+SensorPreselection::Obstacles SensorPreselection::selectObstacles(const std::vector<Position>& area) const
+{
+    queryObstacles();
+
+    Obstacles obstacles;
+    for (const auto& candidate : mObstacles) {
+        if (bg::intersects(candidate.first, area)) {
+            obstacles.push_back(candidate.second);
+        }
+    }
+    return obstacles;
+}
+
+} // namespace artery
@@ -0,0 +1,103 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_SENSORPRESELECTION_H_J5XMC9QD
+#define ENVMOD_SENSORPRESELECTION_H_J5XMC9QD
+
+#include "artery/envmod/Geometry.h"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace artery
+{
+
+class EnvironmentModelObject;
+class EnvironmentModelObstacle;
+class GlobalEnvironmentModel;
+
+/**
+ * SensorPreselection shares one broad-phase query among all sensors of a local environment model
+ *
+ * Sensors announce their areas of interest first. The global environment model is then queried
+ * once for the envelope of all announced areas. Each sensor narrows these candidates down to its
+ * own area by the same bounding box tests the global environment model applies, i.e. sensors get
+ * the same objects and obstacles as by their own preselection queries.
+ */
+class SensorPreselection
+{
+public:
+    using Objects = std::vector<std::shared_ptr<EnvironmentModelObject>>;
+    using Obstacles = std::vector<std::shared_ptr<EnvironmentModelObstacle>>;
+
+    /**
+     * Start a new preselection round, previous candidates are dropped
+     * \param global environment model to query
+     * \param ego identifier of the ego object, which is excluded from candidates
+     */
+    void reset(GlobalEnvironmentModel* global, const std::string& ego);
+
+    /**
+     * Add an area of interest, must precede any selection of this round
+     * \param area polygon, e.g. a sensor cone
+     */
+    void include(const std::vector<Position>& area);
+
+    /**
+     * Request obstacle candidates, otherwise obstacles are only queried on demand
+     */
+    void requestObstacles() { mObstaclesRequested = true; }
+
+    /**
+     * Query candidates of all included areas at once
+     *
+     * Selections are thread-safe afterwards as long as no obstacles are selected without prior request.
+     */
+    void fetch();
+
+    /**
+     * Get ego object looked up once per round
+     * \return ego object or nullptr
+     */
+    const std::shared_ptr<EnvironmentModelObject>& getEgo() const { return mEgo; }
+
+    /**
+     * Select candidate objects whose bounding box intersects the given area
+     * \param area included area of interest
+     * \return candidates in same order as GlobalEnvironmentModel::preselectObjects
+     */
+    Objects selectObjects(const std::vector<Position>& area) const;
+
+    /**
+     * Select candidate obstacles whose bounding box intersects the given area
+     * \param area included area of interest
+     * \return candidates in same order as GlobalEnvironmentModel::preselectObstacles
+     */
+    Obstacles selectObstacles(const std::vector<Position>& area) const;
+
+private:
+    std::vector<Position> envelopeArea() const;
+    void queryObjects() const;
+    void queryObstacles() const;
+
+    GlobalEnvironmentModel* mGlobal = nullptr;
+    std::string mEgoId;
+    std::shared_ptr<EnvironmentModelObject> mEgo;
+    bool mEmpty = true;
+    bool mObstaclesRequested = false;
+    geometry::Box mEnvelope;
+
+    // candidates are queried lazily on first selection
+    mutable bool mObjectsQueried = false;
+    mutable bool mObstaclesQueried = false;
+    mutable std::vector<std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObject>>> mObjects;
+    mutable std::vector<std::pair<geometry::Box, std::shared_ptr<EnvironmentModelObstacle>>> mObstacles;
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_SENSORPRESELECTION_H_J5XMC9QD */
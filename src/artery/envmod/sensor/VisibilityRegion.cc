@@ -0,0 +1,157 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/VisibilityRegion.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+
+namespace bg = boost::geometry;
+
+namespace artery
+{
+
+namespace
+{
+
+// shadows are closed by an arc approximated by chords of at most this angle
+const double maxChordAngle = M_PI / 8.0;
+
+} // namespace
+
+VisibilityRegion::VisibilityRegion(const Position& origin, const std::vector<Position>& cone) :
+    mOrigin(origin.x.value(), origin.y.value()), mShadowLength(1.0)
+{
+    geometry::Polygon polygon;
+    for (const Position& point : cone) {
+        polygon.outer().emplace_back(point.x.value(), point.y.value());
+        mShadowLength = std::max(mShadowLength, 2.0 * bg::distance(mOrigin, polygon.outer().back()));
+    }
+    bg::correct(polygon);
+    if (polygon.outer().size() >= 3) {
+        mRegion.push_back(std::move(polygon));
+    }
+    updateEnvelopes();
+}
+
+void VisibilityRegion::occlude(const std::vector<Position>& outline)
+{
+    if (mRegion.empty() || outline.size() < 3) {
+        return;
+    } else if (bg::covered_by(mOrigin, outline)) {
+        // every line of sight starts within this obstacle
+        mRegion.clear();
+        mEnvelopes.clear();
+        return;
+    }
+
+    const double ox = bg::get<0>(mOrigin);
+    const double oy = bg::get<1>(mOrigin);
+
+    // orientation of outline (shoelace formula) tells which edges face the origin
+    double area = 0.0;
+    for (std::size_t i = 0, j = outline.size() - 1; i < outline.size(); j = i++) {
+        area += outline[j].x.value() * outline[i].y.value() - outline[i].x.value() * outline[j].y.value();
+    }
+
+    geometry::Box envelope;
+    bg::assign_inverse(envelope);
+    for (const geometry::Box& box : mEnvelopes) {
+        bg::expand(envelope, box);
+    }
+
+    bool changed = false;
+    for (std::size_t i = 0, j = outline.size() - 1; i < outline.size(); j = i++) {
+        const double ax = outline[j].x.value();
+        const double ay = outline[j].y.value();
+        const double bx = outline[i].x.value();
+        const double by = outline[i].y.value();
+
+        // any line of sight entering the obstacle crosses an edge facing the origin,
+        // edges collinear with origin are covered by their neighbours' shadows
+        const double side = (bx - ax) * (oy - ay) - (by - ay) * (ox - ax);
+        if (side == 0.0 || (side > 0.0) == (area > 0.0)) {
+            continue;
+        }
+
+        // shadow: edge, rays from origin through its end points and arc beyond the cone
+        const double angleA = std::atan2(ay - oy, ax - ox);
+        double sweep = std::atan2(by - oy, bx - ox) - angleA;
+        if (sweep > M_PI) {
+            sweep -= 2.0 * M_PI;
+        } else if (sweep < -M_PI) {
+            sweep += 2.0 * M_PI;
+        }
+        const unsigned chords = std::max(1u, static_cast<unsigned>(std::ceil(std::abs(sweep) / maxChordAngle)));
+
+        geometry::Polygon shadow;
+        shadow.outer().emplace_back(ax, ay);
+        shadow.outer().emplace_back(bx, by);
+        for (unsigned k = chords + 1; k-- > 0;) {
+            const double angle = angleA + sweep * k / chords;
+            shadow.outer().emplace_back(ox + mShadowLength * std::cos(angle), oy + mShadowLength * std::sin(angle));
+        }
+        bg::correct(shadow);
+
+        if (bg::intersects(bg::return_envelope<geometry::Box>(shadow), envelope)) {
+            MultiPolygon remainder;
+            bg::difference(mRegion, shadow, remainder);
+            mRegion = std::move(remainder);
+            changed = true;
+        }
+    }
+
+    if (changed) {
+        updateEnvelopes();
+    }
+}
+
+bool VisibilityRegion::isVisible(const Position& target) const
+{
+    const geometry::Point point(target.x.value(), target.y.value());
+    for (std::size_t i = 0; i < mRegion.size(); ++i) {
+        if (bg::covered_by(point, mEnvelopes[i]) && bg::covered_by(point, mRegion[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void VisibilityRegion::write(std::ostream& os) const
+{
+    os << std::setprecision(std::numeric_limits<double>::max_digits10) << bg::wkt(mRegion) << "\n";
+}
+
+bool VisibilityRegion::read(std::istream& is)
+{
+    std::string wkt;
+    MultiPolygon region;
+    if (!std::getline(is, wkt)) {
+        return false;
+    }
+    try {
+        bg::read_wkt(wkt, region);
+    } catch (const bg::read_wkt_exception&) {
+        return false;
+    }
+    mRegion = std::move(region);
+    updateEnvelopes();
+    return true;
+}
+
+void VisibilityRegion::updateEnvelopes()
+{
+    mEnvelopes.clear();
+    for (const geometry::Polygon& polygon : mRegion) {
+        mEnvelopes.push_back(bg::return_envelope<geometry::Box>(polygon));
+    }
+}
+
+} // namespace artery
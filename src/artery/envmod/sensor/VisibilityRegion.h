@@ -0,0 +1,75 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ENVMOD_VISIBILITYREGION_H_M3QX8FJD
+#define ENVMOD_VISIBILITYREGION_H_M3QX8FJD
+
+#include "artery/envmod/Geometry.h"
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <iosfwd>
+#include <vector>
+
+namespace artery
+{
+
+/**
+ * VisibilityRegion is the part of a sensor cone not shadowed by static obstacles
+ *
+ * A line of sight from the origin to a point intersects an obstacle if and only if the point lies in
+ * the shadow of one of the obstacle's edges facing the origin. These shadows are subtracted once from
+ * the sensor cone, afterwards a single point-in-region test replaces all line-of-sight tests against
+ * obstacles. Computation is expensive, thus only worthwhile for stationary sensors.
+ */
+class VisibilityRegion
+{
+public:
+    /**
+     * Create region without any obstacles, i.e. the whole cone is visible
+     * \param origin common start point of all lines of sight
+     * \param cone sensor cone
+     */
+    VisibilityRegion(const Position& origin, const std::vector<Position>& cone);
+
+    /**
+     * Remove the shadow cast by an obstacle from region
+     * \param outline obstacle's polygon
+     */
+    void occlude(const std::vector<Position>& outline);
+
+    /**
+     * Check if a point is visible from origin
+     * \param target end point of line of sight
+     * \return true if target is within cone and no obstacle intersects the line of sight
+     */
+    bool isVisible(const Position& target) const;
+
+    bool empty() const { return mRegion.empty(); }
+
+    /**
+     * Store region as well-known text (WKT)
+     */
+    void write(std::ostream&) const;
+
+    /**
+     * Restore region written before for the same origin and cone
+     * \return false if stream contained no valid region
+     */
+    bool read(std::istream&);
+
+private:
+    using MultiPolygon = boost::geometry::model::multi_polygon<geometry::Polygon>;
+
+    void updateEnvelopes();
+
+    geometry::Point mOrigin;
+    double mShadowLength; /*< shadows reach farther than any cone point */
+    MultiPolygon mRegion;
+    std::vector<geometry::Box> mEnvelopes; /*< envelope of each polygon in mRegion */
+};
+
+} // namespace artery
+
+#endif /* ENVMOD_VISIBILITYREGION_H_M3QX8FJD */
@@ -37,7 +37,6 @@ static constexpr std::size_t kCpmObjectIdSpace = 65536;
 static constexpr uint32_t kInvalidLemId = std::numeric_limits<uint32_t>::max();
 static constexpr std::size_t kCpmSensorIdSpace = 256;
 static constexpr int kInvalidLemSensorId = -1;
-static constexpr const_simtime_t kNeverUsedSimTime = -1;
 
 void setPOClassification(Vanetza_ITS2_PerceivedObject_t& po, vanetza::geonet::StationType st)
 {
@@ -174,18 +173,15 @@ void CpService::initialize()
     mMinLastInclusionTimePriorityThreshold = par("minLastInclusionTimePriorityThreshold");
     mMaxLastInclusionTimePriorityThreshold = par("maxLastInclusionTimePriorityThreshold");
 
-    mUnusedObjectIdRetentionPeriod = par("unusedObjectIdRetentionPeriod");
     mHaveStationId = false;
     mLastStationId = 0;
     mLem2Cps.clear();
     mCps2Lem.assign(kCpmObjectIdSpace, kInvalidLemId);
-    mCpmObjectIdLastUsed.assign(kCpmObjectIdSpace, kNeverUsedSimTime);
-    mCpmObjectIdLastAgeMs.assign(kCpmObjectIdSpace, 0);
+    mCpmObjectIds.reset(kCpmObjectIdSpace, par("unusedObjectIdRetentionPeriod").doubleValue(), getRNG(0));
 
-    mUnusedSensorIdRetentionPeriod = par("unusedSensorIdRetentionPeriod");
     mSensorId2Cps.clear();
     mCps2SensorId.assign(kCpmSensorIdSpace, kInvalidLemSensorId);
-    mCpmSensorIdLastUsed.assign(kCpmSensorIdSpace, kNeverUsedSimTime);
+    mCpmSensorIds.reset(kCpmSensorIdSpace, par("unusedSensorIdRetentionPeriod").doubleValue(), getRNG(0));
 
     mDccRestriction = par("withDccRestriction");
 
@@ -428,7 +424,7 @@ void CpService::capturePerceivedObjectSnapshot(
         snap.objectAgeMs = age;
 
         // replace LEM identifier with standard compliant CPM object ID (0..65535, random, reuse holdoff)
-        const auto cpsId = allocateCpmObjectId(T_now, snap.lemId, snap.objectAgeMs);
+        const auto cpsId = allocateCpmObjectId(T_now, snap.lemId);
         if (!cpsId) {
             EV_WARN << "no available CPS object ID";
             continue;
@@ -727,20 +723,15 @@ void CpService::handlePseudonymChange()
     std::fill(mCps2SensorId.begin(), mCps2SensorId.end(), kInvalidLemSensorId);
 }
 
-std::optional<uint16_t> CpService::allocateCpmObjectId(const omnetpp::SimTime& T_now, uint32_t lemId, int64_t objectAgeMs)
+std::optional<uint16_t> CpService::allocateCpmObjectId(const omnetpp::SimTime& T_now, uint32_t lemId)
 {
-    const int64_t retentionSigned = mUnusedObjectIdRetentionPeriod.inUnit(SIMTIME_MS);
-    const SimTime retention = retentionSigned > 0 ? SimTime(retentionSigned, SIMTIME_MS) : SimTime(0, SIMTIME_MS);
-
     // stage 1: reuse existing consistent mapping if still within the retention window
     auto it = mLem2Cps.find(lemId);
     if (it != mLem2Cps.end()) {
         const uint16_t cpsId = it->second;
         if (mCps2Lem[cpsId] == lemId) {
-            const SimTime lastUsed = mCpmObjectIdLastUsed[cpsId];
-            if (lastUsed == kNeverUsedSimTime || (T_now >= lastUsed && (T_now - lastUsed) < retention)) {
-                mCpmObjectIdLastUsed[cpsId] = T_now;
-                mCpmObjectIdLastAgeMs[cpsId] = objectAgeMs;
+            if (mCpmObjectIds.isRetained(cpsId, T_now)) {
+                mCpmObjectIds.touch(cpsId, T_now);
                 return cpsId;
             }
         } else {
@@ -748,42 +739,12 @@ std::optional<uint16_t> CpService::allocateCpmObjectId(const omnetpp::SimTime& T
         }
     }
 
-    // an ID is available if it has never been used or has been idle for at least the retention period
-    auto is_available = [&](uint16_t cpsId) {
-        const SimTime lastUsed = mCpmObjectIdLastUsed[cpsId];
-        if (lastUsed == kNeverUsedSimTime) {
-            return true;
-        }
-        if (T_now < lastUsed) {
-            EV_WARN << "timebase mismatch detected for object ID last used timestamp";
-            return false;
-        }
-        return (T_now - lastUsed) >= retention;
-    };
-    // stage 2: bounded random probe
-    bool found = false;
-    uint16_t chosen = 0;
-    for (int attempt = 0; attempt < 1024; ++attempt) {
-        const uint16_t candidate = static_cast<uint16_t>(intuniform(0, static_cast<int>(kCpmObjectIdSpace - 1)));
-        if (is_available(candidate)) {
-            chosen = candidate;
-            found = true;
-            break;
-        }
-    }
-    // stage 3: deterministic linear scan (guarantees finding an ID if one exists)
-    if (!found) {
-        for (std::size_t id = 0; id < kCpmObjectIdSpace; ++id) {
-            if (is_available(static_cast<uint16_t>(id))) {
-                chosen = static_cast<uint16_t>(id);
-                found = true;
-                break;
-            }
-        }
-    }
-    if (!found) {
+    // stage 2: grant an ID which has never been used or has been idle for at least the retention period
+    const auto granted = mCpmObjectIds.grant(T_now);
+    if (!granted) {
         return std::nullopt;
     }
+    const uint16_t chosen = static_cast<uint16_t>(*granted);
 
     // if the chosen ID was previously bound to another LEM object, remove stale state
     if (mCps2Lem[chosen] != kInvalidLemId) {
@@ -793,8 +754,6 @@ std::optional<uint16_t> CpService::allocateCpmObjectId(const omnetpp::SimTime& T
 
     mLem2Cps[lemId] = chosen;
     mCps2Lem[chosen] = lemId;
-    mCpmObjectIdLastUsed[chosen] = T_now;
-    mCpmObjectIdLastAgeMs[chosen] = objectAgeMs;
 
     return chosen;
 }
@@ -805,48 +764,16 @@ std::optional<uint8_t> CpService::allocateCpmSensorId(const omnetpp::SimTime& T_
     auto it = mSensorId2Cps.find(sensorId);
     if (it != mSensorId2Cps.end()) {
         const uint8_t cpsId = it->second;
-        mCpmSensorIdLastUsed[cpsId] = T_now;
+        mCpmSensorIds.touch(cpsId, T_now);
         return cpsId;
     }
 
-    const int64_t retentionSigned = mUnusedSensorIdRetentionPeriod.inUnit(SIMTIME_MS);
-    const SimTime retention = retentionSigned > 0 ? SimTime(retentionSigned, SIMTIME_MS) : SimTime(0, SIMTIME_MS);
-
-    auto is_available = [&](uint8_t cpsId) {
-        const SimTime lastUsed = mCpmSensorIdLastUsed[cpsId];
-        if (lastUsed == kNeverUsedSimTime) {
-            return true;
-        }
-        if (T_now < lastUsed) {
-            EV_WARN << "timebase mismatch detected for sensor ID last used timestamp";
-            return false;
-        }
-        // allow reuse after retention (even if currently mapped)
-        return (T_now - lastUsed) >= retention;
-    };
-
-    bool found = false;
-    uint8_t chosen = 0;
-    for (int attempt = 0; attempt < 1024; ++attempt) {
-        const int candidate = intuniform(0, static_cast<int>(kCpmSensorIdSpace - 1));
-        chosen = static_cast<uint8_t>(candidate);
-        if (is_available(chosen)) {
-            found = true;
-            break;
-        }
-    }
-    if (!found) {
-        for (std::size_t id = 0; id < kCpmSensorIdSpace; ++id) {
-            chosen = static_cast<uint8_t>(id);
-            if (is_available(chosen)) {
-                found = true;
-                break;
-            }
-        }
-    }
-    if (!found) {
+    // allow reuse after retention (even if currently mapped)
+    const auto granted = mCpmSensorIds.grant(T_now);
+    if (!granted) {
         return std::nullopt;
     }
+    const uint8_t chosen = static_cast<uint8_t>(*granted);
 
     // if reusing an ID which is still mapped, clear the old forward mapping first
     if (mCps2SensorId[chosen] != kInvalidLemSensorId) {
@@ -855,7 +782,6 @@ std::optional<uint8_t> CpService::allocateCpmSensorId(const omnetpp::SimTime& T_
 
     mSensorId2Cps[sensorId] = chosen;
     mCps2SensorId[chosen] = sensorId;
-    mCpmSensorIdLastUsed[chosen] = T_now;
 
     return chosen;
 }
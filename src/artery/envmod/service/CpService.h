@@ -8,6 +8,7 @@
 
 #include "artery/application/ItsG5BaseService.h"
 #include "artery/envmod/LocalEnvironmentModel.h"
+#include "artery/envmod/service/CpmIdAllocator.h"
 #include "artery/utility/Channel.h"
 #include "artery/utility/Geometry.h"
 
@@ -122,7 +123,7 @@ private:
     void sortPerceivedObjects();
     omnetpp::SimTime genCpmDcc();
     void handlePseudonymChange();
-    std::optional<uint16_t> allocateCpmObjectId(const omnetpp::SimTime& T_now, uint32_t lemId, int64_t objectAgeMs);
+    std::optional<uint16_t> allocateCpmObjectId(const omnetpp::SimTime& T_now, uint32_t lemId);
     std::optional<uint8_t> allocateCpmSensorId(const omnetpp::SimTime& T_now, const int sensorId);
     PerceivedObjectType toPOType(vanetza::geonet::StationType st);
 
@@ -159,20 +160,17 @@ private:
     std::vector<std::size_t> mSelectedCpmObjects;  // indices into mPerceivedObjectSnapshot
 
     // CPM object ID allocation. ETSI TS 103 324 (0..65535, reuse holdoff, reset on pseudonym change)
-    omnetpp::SimTime mUnusedObjectIdRetentionPeriod;
     bool mHaveStationId;
     uint32_t mLastStationId;
     std::unordered_map<uint32_t, uint16_t> mLem2Cps;
     std::vector<uint32_t> mCps2Lem;
-    std::vector<omnetpp::SimTime> mCpmObjectIdLastUsed;
-    std::vector<int64_t> mCpmObjectIdLastAgeMs;
+    CpmIdAllocator mCpmObjectIds;
     std::vector<PerceivedObjectSnapshot> mPerceivedObjectSnapshot;
 
     // CPM sensorId allocation. ETSI TS 103 324 (0..255, stable mapping, reuse holdoff, reset on pseudonym change)
-    omnetpp::SimTime mUnusedSensorIdRetentionPeriod;
     std::unordered_map<int, uint8_t> mSensorId2Cps;
     std::vector<int> mCps2SensorId;  // cpsId -> LEM sensorId, kInvalidLemSensorId if not in use
-    std::vector<omnetpp::SimTime> mCpmSensorIdLastUsed;
+    CpmIdAllocator mCpmSensorIds;
     std::vector<SensorSnapshot> mSensorSnapshot;
 };
 
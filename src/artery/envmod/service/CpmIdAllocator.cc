@@ -0,0 +1,141 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/service/CpmIdAllocator.h"
+
+#include <omnetpp/distrib.h>
+
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace artery
+{
+
+using omnetpp::SimTime;
+
+static constexpr CpmIdAllocator::Id kNil = std::numeric_limits<CpmIdAllocator::Id>::max();
+
+void CpmIdAllocator::reset(std::size_t space, SimTime retention, omnetpp::cRNG* rng)
+{
+    assert(space > 0 && space < kNil);
+    mRetention = retention > SimTime::ZERO ? retention : SimTime::ZERO;
+    mRng = rng;
+    mFresh.resize(space);
+    std::iota(mFresh.begin(), mFresh.end(), Id(0));
+    mFreshCount = space;
+    mLastUsed.assign(space, SimTime::ZERO);
+    mState.assign(space, State::Fresh);
+    mPrev.assign(space, kNil);
+    mNext.assign(space, kNil);
+    mInUse = List { kNil, kNil };
+    mReleased.clear();
+    mReleasedIndex.assign(space, 0);
+}
+
+std::optional<CpmIdAllocator::Id> CpmIdAllocator::grant(const SimTime& now)
+{
+    release(now);
+
+    Id id = kNil;
+    if (mFreshCount > 0) {
+        // one step of Fisher-Yates shuffle per grant
+        const std::size_t draw = mRng ? omnetpp::intuniform(mRng, 0, static_cast<int>(mFreshCount - 1)) : mFreshCount - 1;
+        id = mFresh[draw];
+        std::swap(mFresh[draw], mFresh[mFreshCount - 1]);
+        --mFreshCount;
+    } else if (!mReleased.empty()) {
+        const std::size_t draw = mRng ? omnetpp::intuniform(mRng, 0, static_cast<int>(mReleased.size() - 1)) : mReleased.size() - 1;
+        id = mReleased[draw];
+        unpool(id);
+    } else {
+        return std::nullopt;
+    }
+
+    mState[id] = State::InUse;
+    mLastUsed[id] = now;
+    link(mInUse, id);
+    return id;
+}
+
+void CpmIdAllocator::touch(Id id, const SimTime& now)
+{
+    assert(id < space());
+    if (mState[id] == State::InUse) {
+        unlink(mInUse, id);
+    } else if (mState[id] == State::Released) {
+        unpool(id);
+    } else {
+        return; /*< ID has never been granted */
+    }
+
+    mState[id] = State::InUse;
+    mLastUsed[id] = now;
+    link(mInUse, id);
+}
+
+bool CpmIdAllocator::isRetained(Id id, const SimTime& now) const
+{
+    return mState[id] != State::Fresh && !isAvailable(id, now);
+}
+
+bool CpmIdAllocator::isAvailable(Id id, const SimTime& now) const
+{
+    const SimTime& lastUsed = mLastUsed[id];
+    return now > lastUsed && now - lastUsed >= mRetention;
+}
+
+void CpmIdAllocator::release(const SimTime& now)
+{
+    // list is ordered by last use, thus stop at first retained ID
+    while (mInUse.front != kNil && isAvailable(mInUse.front, now)) {
+        const Id id = mInUse.front;
+        unlink(mInUse, id);
+        mState[id] = State::Released;
+        mReleasedIndex[id] = mReleased.size();
+        mReleased.push_back(id);
+    }
+}
+
+void CpmIdAllocator::unpool(Id id)
+{
+    // swap with last pooled ID, thus pool order is arbitrary
+    const std::size_t index = mReleasedIndex[id];
+    const Id last = mReleased.back();
+    mReleased[index] = last;
+    mReleasedIndex[last] = index;
+    mReleased.pop_back();
+}
+
+void CpmIdAllocator::link(List& list, Id id)
+{
+    mPrev[id] = list.back;
+    mNext[id] = kNil;
+    if (list.back != kNil) {
+        mNext[list.back] = id;
+    } else {
+        list.front = id;
+    }
+    list.back = id;
+}
+
+void CpmIdAllocator::unlink(List& list, Id id)
+{
+    if (mPrev[id] != kNil) {
+        mNext[mPrev[id]] = mNext[id];
+    } else {
+        list.front = mNext[id];
+    }
+    if (mNext[id] != kNil) {
+        mPrev[mNext[id]] = mPrev[id];
+    } else {
+        list.back = mPrev[id];
+    }
+    mPrev[id] = mNext[id] = kNil;
+}
+
+} // namespace artery
@@ -0,0 +1,102 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef ARTERY_CPMIDALLOCATOR_H_
+#define ARTERY_CPMIDALLOCATOR_H_
+
+#include <omnetpp/simtime.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace omnetpp
+{
+class cRNG;
+} // namespace omnetpp
+
+namespace artery
+{
+
+/**
+ * Retention-aware allocator of CPM identifiers (object and sensor IDs)
+ *
+ * An ID is available if it has never been used or has been idle for at least the retention period.
+ * IDs used at the current time are never available, i.e. no ID is granted twice for the same message.
+ * Never used IDs are granted first in the order of a seeded random permutation, which is drawn incrementally.
+ * Afterwards, released IDs are drawn uniformly from the pool of available IDs.
+ * Granted IDs are linked in a list ordered by their last use: expired IDs are released in batches
+ * from its front and grants take amortized constant time.
+ */
+class CpmIdAllocator
+{
+public:
+    using Id = std::uint32_t;
+
+    /**
+     * Reset allocator, all IDs become never used
+     * \param space number of IDs, i.e. IDs range from 0 to space - 1
+     * \param retention minimum idle time before an ID is granted again
+     * \param rng random number generator for drawing available IDs, fixed order if nullptr
+     */
+    void reset(std::size_t space, omnetpp::SimTime retention, omnetpp::cRNG* rng);
+
+    /**
+     * Grant an available ID and mark it as used
+     * \param now current time
+     * \return granted ID or nothing if all IDs are retained
+     */
+    std::optional<Id> grant(const omnetpp::SimTime& now);
+
+    /**
+     * Mark an ID as used again
+     * \param id previously granted ID
+     * \param now current time
+     */
+    void touch(Id id, const omnetpp::SimTime& now);
+
+    /**
+     * Check if an ID has been used within the retention period
+     * \param id any ID
+     * \param now current time
+     * \return true if ID is not available for grants
+     */
+    bool isRetained(Id id, const omnetpp::SimTime& now) const;
+
+    std::size_t space() const { return mLastUsed.size(); }
+
+private:
+    enum class State : std::uint8_t { Fresh, InUse, Released };
+
+    struct List
+    {
+        Id front;
+        Id back;
+    };
+
+    bool isAvailable(Id id, const omnetpp::SimTime& now) const;
+    void release(const omnetpp::SimTime& now);
+    void unpool(Id);
+    void link(List&, Id);
+    void unlink(List&, Id);
+
+    omnetpp::SimTime mRetention;
+    omnetpp::cRNG* mRng = nullptr;
+    std::vector<Id> mFresh; /*< never used IDs, the first mFreshCount entries are not yet drawn */
+    std::size_t mFreshCount = 0;
+    std::vector<omnetpp::SimTime> mLastUsed;
+    std::vector<State> mState;
+    std::vector<Id> mPrev;
+    std::vector<Id> mNext;
+    List mInUse; /*< granted IDs ordered by last use */
+    std::vector<Id> mReleased; /*< available IDs in arbitrary order */
+    std::vector<std::size_t> mReleasedIndex; /*< position of each released ID in mReleased */
+};
+
+} // namespace artery
+
+#endif /* ARTERY_CPMIDALLOCATOR_H_ */
@@ -28,16 +28,16 @@ void EnvmodPrinter::initialize()
 void EnvmodPrinter::trigger()
 {
     Enter_Method("trigger");
-    auto& allObjects = mLocalEnvironmentModel->allObjects();
+    const LocalEnvironmentModel& lem = *mLocalEnvironmentModel;
 
     EV_DETAIL << mEgoId << "--- By category ---" << std::endl;
-    printSensorObjectList("Radar Sensor Object List", filterBySensorCategory(allObjects, "Radar"));
-    printSensorObjectList("CAM Sensor Object List", filterBySensorCategory(allObjects, "CA"));
+    printSensorObjectList("Radar Sensor Object List", filterBySensorCategory(lem, "Radar"));
+    printSensorObjectList("CAM Sensor Object List", filterBySensorCategory(lem, "CA"));
 
     EV_DETAIL << mEgoId << "--- By name ---" << std::endl;
     for (auto &sensor: mLocalEnvironmentModel->getSensors()) {
         std::string sensorName = sensor->getSensorName();
-        printSensorObjectList(sensorName + " Object List", filterBySensorName(allObjects, sensorName));
+        printSensorObjectList(sensorName + " Object List", filterBySensorName(lem, sensorName));
     }
 }
 
@@ -0,0 +1,193 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/service/CpmIdAllocator.h"
+#include <omnetpp/crng.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <random>
+#include <set>
+#include <vector>
+
+using artery::CpmIdAllocator;
+using omnetpp::SimTime;
+
+namespace
+{
+
+int failures = 0;
+
+void check(bool condition, const char* what)
+{
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+// seeded RNG independent of simulation kernel configuration
+class TestRng : public omnetpp::cRNG
+{
+public:
+    explicit TestRng(std::uint32_t seed) : mEngine(seed) {}
+
+    unsigned long getNumbersDrawn() const override { return mDrawn; }
+    std::uint32_t intRand() override { ++mDrawn; return mEngine(); }
+    std::uint32_t intRandMax() override { return std::mt19937::max(); }
+    std::uint32_t intRand(std::uint32_t n) override { return std::uniform_int_distribution<std::uint32_t>(0, n - 1)(counted()); }
+    double doubleRand() override { return std::uniform_real_distribution<double>(0.0, 1.0)(counted()); }
+    double doubleRandNonz() override { return std::uniform_real_distribution<double>(std::numeric_limits<double>::min(), 1.0)(counted()); }
+    double doubleRandIncl1() override { return std::generate_canonical<double, 32>(counted()); }
+
+private:
+    std::mt19937& counted() { ++mDrawn; return mEngine; }
+
+    std::mt19937 mEngine;
+    unsigned long mDrawn = 0;
+};
+
+void testExhaustion()
+{
+    CpmIdAllocator ids;
+    ids.reset(8, SimTime(1.0), nullptr);
+
+    const SimTime now(10.0);
+    std::set<CpmIdAllocator::Id> granted;
+    for (int i = 0; i < 8; ++i) {
+        auto id = ids.grant(now);
+        check(id.has_value(), "exhaustion: grant within space");
+        if (id) {
+            check(*id < ids.space(), "exhaustion: ID within space");
+            granted.insert(*id);
+        }
+    }
+    check(granted.size() == 8, "exhaustion: all IDs distinct");
+    check(!ids.grant(now), "exhaustion: no grant beyond space");
+    check(!ids.grant(now + SimTime(0.5)), "exhaustion: no grant within retention");
+}
+
+void testReleaseReuse()
+{
+    CpmIdAllocator ids;
+    ids.reset(4, SimTime(1.0), nullptr);
+
+    const SimTime start(10.0);
+    std::set<CpmIdAllocator::Id> first;
+    for (int i = 0; i < 4; ++i) {
+        first.insert(*ids.grant(start));
+    }
+
+    // keep one ID alive, the others expire
+    const CpmIdAllocator::Id kept = *first.begin();
+    ids.touch(kept, start + SimTime(0.9));
+    check(ids.isRetained(kept, start + SimTime(1.0)), "reuse: touched ID is retained");
+
+    const SimTime later = start + SimTime(1.0);
+    std::set<CpmIdAllocator::Id> second;
+    while (auto id = ids.grant(later)) {
+        second.insert(*id);
+    }
+    check(second.size() == 3, "reuse: expired IDs are granted again");
+    check(second.count(kept) == 0, "reuse: retained ID is not granted");
+
+    // retention has elapsed for the kept ID
+    auto id = ids.grant(start + SimTime(1.9));
+    check(id && *id == kept, "reuse: kept ID is granted after its retention");
+}
+
+void testPseudonymChange()
+{
+    CpmIdAllocator ids;
+    ids.reset(16, SimTime(2.0), nullptr);
+
+    // object mappings as maintained by CpService, i.e. LEM object ID -> CPM object ID
+    std::map<int, CpmIdAllocator::Id> mapping;
+    auto allocate = [&](int object, const SimTime& now) -> std::optional<CpmIdAllocator::Id> {
+        auto found = mapping.find(object);
+        if (found != mapping.end() && ids.isRetained(found->second, now)) {
+            ids.touch(found->second, now);
+            return found->second;
+        }
+        auto id = ids.grant(now);
+        if (id) {
+            mapping[object] = *id;
+        }
+        return id;
+    };
+
+    std::set<CpmIdAllocator::Id> before;
+    for (int object = 0; object < 10; ++object) {
+        before.insert(*allocate(object, SimTime(5.0)));
+    }
+    check(*allocate(3, SimTime(5.2)) == mapping[3], "pseudonym change: mapping is stable before change");
+
+    // CpService::handlePseudonymChange clears mappings but keeps the allocator, thus IDs stay on hold
+    mapping.clear();
+    std::set<CpmIdAllocator::Id> after;
+    for (int object = 0; object < 10; ++object) {
+        auto id = allocate(object, SimTime(5.5));
+        if (id) {
+            check(before.count(*id) == 0, "pseudonym change: no previous ID is linked to new pseudonym");
+            check(after.insert(*id).second, "pseudonym change: no duplicate grants");
+        }
+    }
+    check(after.size() == 6, "pseudonym change: only IDs never used before are granted");
+    check(!allocate(6, SimTime(6.9)), "pseudonym change: no grant while previous IDs are on hold");
+
+    // holdoff of IDs used before the change has elapsed
+    for (int object = 6; object < 10; ++object) {
+        auto id = allocate(object, SimTime(7.2));
+        check(id && before.count(*id) == 1, "pseudonym change: previous IDs are granted after holdoff");
+    }
+}
+
+std::vector<CpmIdAllocator::Id> drawIds(omnetpp::cRNG* rng, int count)
+{
+    CpmIdAllocator ids;
+    ids.reset(256, SimTime(1.0), rng);
+    std::vector<CpmIdAllocator::Id> drawn;
+    for (int i = 0; i < count; ++i) {
+        drawn.push_back(*ids.grant(SimTime(1.0)));
+    }
+    return drawn;
+}
+
+void testRandomOrder()
+{
+    TestRng rng1(42);
+    TestRng rng2(42);
+    TestRng rng3(43);
+    const auto fixed = drawIds(nullptr, 32);
+    const auto seeded = drawIds(&rng1, 32);
+
+    check(std::set<CpmIdAllocator::Id>(seeded.begin(), seeded.end()).size() == seeded.size(), "random order: all IDs distinct");
+    check(seeded != fixed, "random order: order differs from fixed order");
+    check(seeded == drawIds(&rng2, 32), "random order: same seed reproduces order");
+    check(seeded != drawIds(&rng3, 32), "random order: other seed changes order");
+}
+
+} // namespace
+
+int main()
+{
+    // simulation time resolution is configured by the simulation kernel otherwise
+    SimTime::setScaleExp(-12);
+
+    testExhaustion();
+    testReleaseReuse();
+    testPseudonymChange();
+    testRandomOrder();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,214 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/ObjectIndex.h"
+#include "artery/envmod/CompactOutline.h"
+#include "artery/envmod/EnvironmentModelObject.h"
+#include <boost/units/systems/si/length.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+using artery::EnvironmentModelObject;
+using artery::ObjectIndex;
+using artery::Position;
+using Outline = std::vector<Position>;
+
+namespace bg = boost::geometry;
+
+namespace
+{
+
+int failures = 0;
+
+void check(bool condition, const char* what)
+{
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+Outline createBox(double x, double y, double width, double height, double rotation)
+{
+    Outline box;
+    const double c = std::cos(rotation);
+    const double s = std::sin(rotation);
+    for (auto corner : { std::make_pair(0.0, 0.0), std::make_pair(width, 0.0), std::make_pair(width, height), std::make_pair(0.0, height) }) {
+        box.emplace_back(x + c * corner.first - s * corner.second, y + s * corner.first + c * corner.second);
+    }
+    bg::correct(box);
+    return box;
+}
+
+// rotated box like a vehicle, only its outline is relevant for object indices
+class BoxObject : public EnvironmentModelObject
+{
+public:
+    BoxObject(double x, double y, double rotation) { move(x, y, rotation); }
+
+    void move(double x, double y, double rotation)
+    {
+        mCentre = Position { x, y };
+        mRotation = rotation;
+        mOutline = createBox(x - 2.5, y - 1.0, 5.0, 2.0, rotation);
+        mCompactOutline.assign(mOutline);
+    }
+
+    const Position& getCentre() const { return mCentre; }
+    double getRotation() const { return mRotation; }
+
+    void update() override {}
+    std::string getExternalId() const override { return "box"; }
+    const std::vector<Position>& getOutline() const override { return mOutline; }
+    const artery::CompactOutline& getCompactOutline() const override { return mCompactOutline; }
+    const Position& getAttachmentPoint(const artery::SensorPosition&) const override { return mCentre; }
+    const Position& getCentrePoint() const override { return mCentre; }
+    Heading getHeading() const override { return Heading { mRotation }; }
+    Length getLength() const override { return 5.0 * boost::units::si::meter; }
+    Length getWidth() const override { return 2.0 * boost::units::si::meter; }
+    Length getRadius() const override { return 2.7 * boost::units::si::meter; }
+    bool isVisible() override { return true; }
+
+private:
+    Position mCentre;
+    double mRotation = 0.0;
+    Outline mOutline;
+    artery::CompactOutline mCompactOutline;
+};
+
+using Found = std::vector<const EnvironmentModelObject*>;
+
+Found query(const ObjectIndex& index, const Outline& area)
+{
+    Found found;
+    index.query(area, [&found](const ObjectIndex::Object& object) { found.push_back(object.get()); });
+    return found;
+}
+
+std::set<const EnvironmentModelObject*> as_set(const Found& found)
+{
+    return std::set<const EnvironmentModelObject*>(found.begin(), found.end());
+}
+
+void testRandomMovement()
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> coordinate(0.0, 500.0);
+    std::uniform_real_distribution<double> angle(-M_PI, M_PI);
+    std::normal_distribution<double> step(0.0, 3.0);
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+
+    artery::RebuildObjectIndex reference;
+    artery::IncrementalObjectIndex incremental(2.0);
+    artery::GridObjectIndex grid(20.0);
+    std::vector<ObjectIndex*> indices { &reference, &incremental, &grid };
+
+    std::vector<std::shared_ptr<BoxObject>> objects;
+    // rank of objects in grid's insertion order, re-inserted objects are ranked last
+    std::unordered_map<const EnvironmentModelObject*, unsigned> rank;
+    unsigned nextRank = 0;
+    auto insert = [&](const std::shared_ptr<BoxObject>& object) {
+        for (ObjectIndex* index : indices) {
+            index->insert(object);
+        }
+        rank[object.get()] = nextRank++;
+    };
+
+    for (int i = 0; i < 300; ++i) {
+        objects.push_back(std::make_shared<BoxObject>(coordinate(rng), coordinate(rng), angle(rng)));
+        insert(objects.back());
+    }
+
+    for (int round = 0; round < 50; ++round) {
+        for (auto& object : objects) {
+            if (chance(rng) < 0.02) {
+                // object leaves and re-enters the simulation somewhere else
+                for (ObjectIndex* index : indices) {
+                    index->remove(object);
+                }
+                object->move(coordinate(rng), coordinate(rng), angle(rng));
+                insert(object);
+            } else if (chance(rng) < 0.8) {
+                const Position& centre = object->getCentre();
+                object->move(centre.x.value() + step(rng), centre.y.value() + step(rng), object->getRotation() + 0.1 * step(rng));
+                for (ObjectIndex* index : indices) {
+                    index->update(object);
+                }
+            }
+        }
+        for (ObjectIndex* index : indices) {
+            index->commit();
+            check(index->size() == objects.size(), "random movement: all objects are indexed");
+        }
+
+        for (int q = 0; q < 20; ++q) {
+            const double size = q == 0 ? 600.0 : 10.0 + 100.0 * chance(rng);
+            const Outline area = q == 0 ?
+                createBox(-50.0, -50.0, size, size, 0.0) :
+                createBox(coordinate(rng), coordinate(rng), size, 0.5 * size, angle(rng));
+
+            const auto expected = as_set(query(reference, area));
+            const Found fromIncremental = query(incremental, area);
+            const Found fromGrid = query(grid, area);
+            check(fromIncremental.size() == expected.size() && as_set(fromIncremental) == expected,
+                    "random movement: incremental index finds same objects as rebuild index");
+            check(fromGrid.size() == expected.size() && as_set(fromGrid) == expected,
+                    "random movement: grid index finds same objects as rebuild index");
+
+            // consumers rely on this order, e.g. for reproducible sensor detections
+            const bool ordered = std::is_sorted(fromGrid.begin(), fromGrid.end(),
+                    [&rank](const EnvironmentModelObject* a, const EnvironmentModelObject* b) { return rank.at(a) < rank.at(b); });
+            check(ordered, "random movement: grid index visits objects in insertion order");
+        }
+    }
+}
+
+void testGridOrderIndependentOfArea()
+{
+    artery::GridObjectIndex grid(10.0);
+    std::vector<std::shared_ptr<BoxObject>> objects;
+    // inserted in reverse cell order, i.e. cell traversal order differs from insertion order
+    for (int i = 9; i >= 0; --i) {
+        objects.push_back(std::make_shared<BoxObject>(5.0 + 10.0 * i, 5.0 + 10.0 * (i % 3), 0.0));
+        grid.insert(objects.back());
+    }
+
+    const Found all = query(grid, createBox(-5.0, -5.0, 110.0, 40.0, 0.0));
+    check(all.size() == objects.size(), "grid order: large area finds all objects");
+    const Found part = query(grid, createBox(22.0, -5.0, 50.0, 40.0, 0.3));
+    check(!part.empty() && part.size() < all.size(), "grid order: small area finds some objects");
+
+    // objects found by both queries are visited in the same relative order
+    Found common;
+    std::copy_if(all.begin(), all.end(), std::back_inserter(common),
+            [&part](const EnvironmentModelObject* object) { return std::find(part.begin(), part.end(), object) != part.end(); });
+    check(common == part, "grid order: order is independent of queried area");
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        check(all[i] == objects[i].get(), "grid order: objects are visited in insertion order");
+    }
+}
+
+} // namespace
+
+int main()
+{
+    testRandomMovement();
+    testGridOrderIndependentOfArea();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
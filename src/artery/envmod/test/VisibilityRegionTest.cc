@@ -0,0 +1,221 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "artery/envmod/sensor/VisibilityRegion.h"
+#include <boost/geometry/geometries/register/linestring.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using artery::Position;
+using artery::VisibilityRegion;
+using Outline = std::vector<Position>;
+using LineOfSight = std::array<Position, 2>;
+BOOST_GEOMETRY_REGISTER_LINESTRING(LineOfSight)
+
+namespace bg = boost::geometry;
+
+namespace
+{
+
+int failures = 0;
+
+void check(bool condition, const char* what)
+{
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++failures;
+    }
+}
+
+Outline createCone(const Position& origin, double heading, double opening, double range, unsigned segments)
+{
+    Outline cone;
+    if (opening < 2.0 * M_PI) {
+        cone.push_back(origin);
+    }
+    for (unsigned i = 0; i <= segments; ++i) {
+        const double angle = heading - 0.5 * opening + opening * i / segments;
+        cone.emplace_back(origin.x.value() + range * std::cos(angle), origin.y.value() + range * std::sin(angle));
+    }
+    if (opening >= 2.0 * M_PI) {
+        cone.pop_back();
+    }
+    bg::correct(cone);
+    return cone;
+}
+
+Outline createBox(double x, double y, double width, double height, double rotation)
+{
+    Outline box;
+    const double c = std::cos(rotation);
+    const double s = std::sin(rotation);
+    for (auto corner : { std::make_pair(0.0, 0.0), std::make_pair(width, 0.0), std::make_pair(width, height), std::make_pair(0.0, height) }) {
+        box.emplace_back(x + c * corner.first - s * corner.second, y + s * corner.first + c * corner.second);
+    }
+    bg::correct(box);
+    return box;
+}
+
+// same test as FovSensor's per-step line-of-sight check against obstacles
+bool isVisiblePerStep(const Position& origin, const Outline& cone, const std::vector<Outline>& obstacles, const Position& target)
+{
+    if (!bg::covered_by(target, cone)) {
+        return false;
+    }
+    const LineOfSight lineOfSight { origin, target };
+    for (const Outline& obstacle : obstacles) {
+        if (bg::intersects(lineOfSight, obstacle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// points close to region boundaries may be classified differently due to rounding
+bool isAmbiguous(const Position& origin, const Outline& cone, const std::vector<Outline>& obstacles, const Position& target)
+{
+    const double tolerance = 1e-6;
+    const double px = target.x.value();
+    const double py = target.y.value();
+    auto nearSegment = [&](double ax, double ay, double bx, double by) {
+        const double dx = bx - ax;
+        const double dy = by - ay;
+        const double t = std::max(0.0, std::min(1.0, ((px - ax) * dx + (py - ay) * dy) / (dx * dx + dy * dy)));
+        return std::hypot(ax + t * dx - px, ay + t * dy - py) < tolerance;
+    };
+    auto nearRing = [&](const Outline& ring) {
+        for (std::size_t i = 0, j = ring.size() - 1; i < ring.size(); j = i++) {
+            if (nearSegment(ring[j].x.value(), ring[j].y.value(), ring[i].x.value(), ring[i].y.value())) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (nearRing(cone)) {
+        return true;
+    }
+    const double ox = origin.x.value();
+    const double oy = origin.y.value();
+    for (const Outline& obstacle : obstacles) {
+        if (nearRing(obstacle)) {
+            return true;
+        }
+        for (const Position& vertex : obstacle) {
+            // ray from origin through vertex bounds a shadow
+            const double vx = vertex.x.value() - ox;
+            const double vy = vertex.y.value() - oy;
+            const double scale = 1e4 / std::hypot(vx, vy);
+            if (nearSegment(ox, oy, ox + scale * vx, oy + scale * vy)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void compare(const Position& origin, const Outline& cone, const std::vector<Outline>& obstacles,
+        const VisibilityRegion& region, std::mt19937& rng, const char* what)
+{
+    const bg::model::box<Position> envelope = bg::return_envelope<bg::model::box<Position>>(cone);
+    std::uniform_real_distribution<double> x(envelope.min_corner().x.value(), envelope.max_corner().x.value());
+    std::uniform_real_distribution<double> y(envelope.min_corner().y.value(), envelope.max_corner().y.value());
+
+    unsigned mismatches = 0;
+    unsigned visible = 0;
+    unsigned hidden = 0;
+    for (unsigned i = 0; i < 20000; ++i) {
+        const Position target(x(rng), y(rng));
+        if (isAmbiguous(origin, cone, obstacles, target)) {
+            continue;
+        }
+        const bool expected = isVisiblePerStep(origin, cone, obstacles, target);
+        if (region.isVisible(target) != expected) {
+            ++mismatches;
+        }
+        ++(expected ? visible : hidden);
+    }
+    check(mismatches == 0, what);
+    check(visible > 0 && hidden > 0, "sample points cover visible and hidden areas");
+}
+
+void testConsistency()
+{
+    std::mt19937 rng(4711);
+    std::uniform_real_distribution<double> coordinate(-150.0, 150.0);
+    std::uniform_real_distribution<double> extent(2.0, 30.0);
+    std::uniform_real_distribution<double> rotation(0.0, M_PI);
+
+    const Position origin(3.0, -7.0);
+    std::vector<Outline> obstacles;
+    for (unsigned i = 0; i < 40; ++i) {
+        Outline box = createBox(coordinate(rng), coordinate(rng), extent(rng), extent(rng), rotation(rng));
+        if (!bg::covered_by(origin, box)) {
+            obstacles.push_back(std::move(box));
+        }
+    }
+    // concave building with a courtyard opening towards the origin
+    obstacles.push_back(Outline {
+        Position(40.0, 20.0), Position(40.0, 60.0), Position(80.0, 60.0), Position(80.0, 20.0),
+        Position(70.0, 20.0), Position(70.0, 50.0), Position(50.0, 50.0), Position(50.0, 20.0) });
+    bg::correct(obstacles.back());
+
+    for (double opening : { 0.5 * M_PI, 2.0 * M_PI }) {
+        const Outline cone = createCone(origin, 0.3, opening, 120.0, 24);
+        VisibilityRegion region(origin, cone);
+        for (const Outline& obstacle : obstacles) {
+            region.occlude(obstacle);
+        }
+        compare(origin, cone, obstacles, region, rng, "consistency: static region matches per-step line of sight");
+
+        std::stringstream stream;
+        region.write(stream);
+        VisibilityRegion restored(origin, cone);
+        check(restored.read(stream), "consistency: stored region can be read");
+        compare(origin, cone, obstacles, restored, rng, "consistency: restored region matches per-step line of sight");
+    }
+}
+
+void testOriginInsideObstacle()
+{
+    const Position origin(0.0, 0.0);
+    const Outline cone = createCone(origin, 0.0, 2.0 * M_PI, 50.0, 12);
+    VisibilityRegion region(origin, cone);
+    check(region.isVisible(Position(10.0, 10.0)), "inside: visible without obstacles");
+    region.occlude(createBox(-1.0, -1.0, 2.0, 2.0, 0.0));
+    check(region.empty(), "inside: nothing visible from within an obstacle");
+    check(!region.isVisible(Position(10.0, 10.0)), "inside: point hidden");
+}
+
+void testMalformedInput()
+{
+    const Position origin(0.0, 0.0);
+    VisibilityRegion region(origin, createCone(origin, 0.0, M_PI, 50.0, 6));
+    std::istringstream stream("no geometry");
+    check(!region.read(stream), "malformed: rejected");
+    check(region.isVisible(Position(10.0, 1.0)), "malformed: region unchanged");
+}
+
+} // namespace
+
+int main()
+{
+    testConsistency();
+    testOriginInsideObstacle();
+    testMalformedInput();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "all visibility region checks passed" << std::endl;
+    return EXIT_SUCCESS;
+}
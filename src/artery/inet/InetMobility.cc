@@ -28,6 +28,7 @@ void InetMobility::initialize(int stage)
     if (stage == inet::INITSTAGE_LOCAL) {
         mVisualRepresentation = inet::getModuleFromPar<cModule>(par("visualRepresentation"), this, false);
         mAntennaHeight = par("antennaHeight");
+        configureInterpolation(par("interpolation").stdstringValue(), par("interpolationHorizon").doubleValue());
         WATCH(mPosition);
         WATCH(mSpeed);
         WATCH(mOrientation);
@@ -48,17 +49,35 @@ double InetMobility::getMaxSpeed() const
 
 inet::Coord InetMobility::getCurrentPosition()
 {
-    return mPosition;
+    if (mInterpolation == Interpolation::None) {
+        return mPosition;
+    }
+
+    using boost::units::si::meter;
+    const Kinematics state = interpolate(omnetpp::simTime());
+    return inet::Coord { state.position.x / meter, state.position.y / meter, mAntennaHeight };
 }
 
 inet::Coord InetMobility::getCurrentSpeed()
 {
-    return mSpeed;
+    if (mInterpolation == Interpolation::None) {
+        return mSpeed;
+    }
+
+    const Kinematics state = interpolate(omnetpp::simTime());
+    const double rad = state.heading.radian();
+    return inet::Coord { cos(rad), -sin(rad) } * state.speed;
 }
 
 inet::EulerAngles InetMobility::getCurrentAngularPosition()
 {
-    return mOrientation;
+    if (mInterpolation == Interpolation::None) {
+        return mOrientation;
+    }
+
+    inet::EulerAngles orientation = mOrientation;
+    orientation.alpha = -interpolate(omnetpp::simTime()).heading.radian();
+    return orientation;
 }
 
 inet::EulerAngles InetMobility::getCurrentAngularSpeed()
@@ -86,6 +105,7 @@ void InetMobility::initialize(const Position& pos, Angle heading, double speed)
     mPosition = inet::Coord { pos.x / meter, pos.y / meter, mAntennaHeight };
     mSpeed = direction * speed;
     mOrientation.alpha = -rad;
+    recordKinematics(pos, heading, speed);
 }
 
 void InetMobility::update(const Position& pos, Angle heading, double speed)
@@ -10,6 +10,7 @@
 #include "traci/Core.h"
 #include "traci/BasicNodeManager.h"
 #include "traci/API.h"
+#include "traci/VariableCache.h"
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/register/linestring.hpp>
 #include <boost/geometry/strategies/transform/matrix_transformers.hpp>
@@ -46,7 +47,7 @@ void VehicleIndex::initialize()
     if (traci) {
         traci->subscribe(traci::BasicNodeManager::updateNodeSignal, this);
         traci->subscribe(traci::BasicNodeManager::addVehicleSignal, this);
-        traci->subscribe(traci::BasicNodeManager::updateVehicleSignal, this);
+        traci->subscribe(traci::BasicNodeManager::updateVehiclesSignal, this);
         traci->subscribe(traci::BasicNodeManager::removeVehicleSignal, this);
     } else {
         throw cRuntimeError("No TraCI module found for signal subscription");
@@ -78,9 +79,14 @@ void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, const c
 {
     Enter_Method_Silent();
     if (signal == traci::BasicNodeManager::addVehicleSignal) {
-        auto api = check_and_cast<traci::NodeManager*>(source)->getAPI();
-        ASSERT(api);
-        Vehicle vehicle(*api, id, mVehicleMargin);
+        auto manager = check_and_cast<traci::BasicNodeManager*>(source);
+        if (!mBoundary) {
+            auto api = manager->getAPI();
+            ASSERT(api);
+            mBoundary = traci::Boundary { api->simulation.getNetBoundary() };
+        }
+        auto cache = manager->getSubscriptions()->getVehicleCache(id);
+        Vehicle vehicle(*cache, *mBoundary, mVehicleMargin);
         auto insertion = mVehicles.emplace(id, std::move(vehicle));
         if (insertion.second) {
             const Vehicle& vehicle = insertion.first->second;
@@ -88,17 +94,40 @@ void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, const c
                 bg::return_envelope<RtreeValue::first_type>(vehicle.getOutline()),
                 insertion.first };
             mVehicleRtree.insert(std::move(value));
+
+            const traci::IdInterner::Handle handle = cache->getHandle();
+            ASSERT(handle != traci::IdInterner::invalid);
+            if (mVehicleHandles.size() <= handle) {
+                mVehicleHandles.resize(handle + 1, nullptr);
+            }
+            mVehicleHandles[handle] = &insertion.first->second;
         }
-    } else if (signal == traci::BasicNodeManager::updateVehicleSignal) {
-        auto vehicle = check_and_cast<traci::BasicNodeManager::VehicleObject*>(obj);
-        mVehicles.at(id).update(vehicle->getPosition(), vehicle->getHeading());
-        mRtreeTainted = true;
     } else if (signal == traci::BasicNodeManager::removeVehicleSignal) {
+        auto manager = check_and_cast<traci::BasicNodeManager*>(source);
+        const traci::IdInterner::Handle handle = manager->getSubscriptions()->getVehicleIds().find(id);
+        if (handle < mVehicleHandles.size()) {
+            mVehicleHandles[handle] = nullptr;
+        }
         mVehicles.erase(id);
         mRtreeTainted = true;
     }
 }
 
+void VehicleIndex::receiveSignal(cComponent* source, simsignal_t signal, cObject* obj, cObject*)
+{
+    Enter_Method_Silent();
+    if (signal == traci::BasicNodeManager::updateVehiclesSignal) {
+        auto snapshot = check_and_cast<traci::BasicNodeManager::VehicleSnapshot*>(obj);
+        for (const traci::BasicNodeManager::VehicleState& state : snapshot->getVehicles()) {
+            Vehicle* vehicle = state.handle < mVehicleHandles.size() ? mVehicleHandles[state.handle] : nullptr;
+            if (vehicle) {
+                vehicle->update(state.position, state.heading);
+            }
+        }
+        mRtreeTainted = true;
+    }
+}
+
 bool VehicleIndex::anyBlockage(const Position& a, const Position& b) const
 {
     ASSERT(!mRtreeTainted && mVehicles.size() == mVehicleRtree.size());
@@ -141,13 +170,13 @@ VehicleIndex::getObstructingVehicles(const Position& a, const Position& b) const
     return result;
 }
 
-VehicleIndex::Vehicle::Vehicle(const traci::API& api, const std::string& id, double margin) :
-    mBoundary(api.simulation.getNetBoundary()), mHeight(0.0)
+VehicleIndex::Vehicle::Vehicle(traci::VehicleCache& cache, const traci::Boundary& boundary, double margin) :
+    mBoundary(boundary), mHeight(0.0)
 {
-    auto vtype = api.vehicle.getTypeID(id);
-    mHeight = api.vehicletype.getHeight(vtype);
-    createLocalOutline(api.vehicletype.getWidth(vtype), api.vehicletype.getLength(vtype), margin);
-    update(api.vehicle.getPosition(id), traci::TraCIAngle { api.vehicle.getAngle(id) });
+    // dimensions are kept by cache since the vehicle's departure subscription
+    mHeight = cache.get<libsumo::VAR_HEIGHT>();
+    createLocalOutline(cache.get<libsumo::VAR_WIDTH>(), cache.get<libsumo::VAR_LENGTH>(), margin);
+    update(cache.get<libsumo::VAR_POSITION>(), traci::TraCIAngle { cache.get<libsumo::VAR_ANGLE>() });
 }
 
 void VehicleIndex::Vehicle::update(const traci::TraCIPosition& pos, traci::TraCIAngle heading)
@@ -12,6 +12,7 @@
 #include "traci/Boundary.h"
 #include "traci/Position.h"
 #include <boost/geometry/index/rtree.hpp>
+#include <boost/optional/optional.hpp>
 #include <omnetpp/clistener.h>
 #include <omnetpp/csimplemodule.h>
 #include <functional>
@@ -19,7 +20,7 @@
 #include <vector>
 
 // forward declaration
-namespace traci { class API; }
+namespace traci { class VehicleCache; }
 
 namespace artery
 {
@@ -34,7 +35,13 @@ public:
     class Vehicle
     {
     public:
-        Vehicle(const traci::API&, const std::string& id, double margin = 0.0);
+        /**
+         * Create vehicle from its subscribed state
+         * \param cache vehicle's variable cache providing position, heading and dimensions
+         * \param boundary SUMO network boundary
+         * \param margin additional space around vehicle outline
+         */
+        Vehicle(traci::VehicleCache& cache, const traci::Boundary& boundary, double margin = 0.0);
         void update(const traci::TraCIPosition& pos, traci::TraCIAngle heading);
         const std::vector<Position>& getOutline() const { return mWorldOutline; }
         const double getHeight() const { return mHeight; }
@@ -60,6 +67,7 @@ public:
     // cListener
     void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, unsigned long, omnetpp::cObject*) override;
     void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, const char*, omnetpp::cObject*) override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, omnetpp::cObject*, omnetpp::cObject*) override;
 
     bool anyBlockage(const Position& a, const Position& b) const;
     bool anyBlockage(const Position& a, const Position& b, double height) const;
@@ -104,6 +112,8 @@ private:
     void vehiclesEllipse(const Position& a, const Position& b, double r, std::function<void(const Vehicle&)>) const;
 
     VehicleMap mVehicles;
+    boost::optional<traci::Boundary> mBoundary; /*< fetched once for all vehicles */
+    std::vector<Vehicle*> mVehicleHandles; /*< indexed by TraCI vehicle handle */
     Rtree mVehicleRtree;
     bool mRtreeTainted = false;
     Visualizer* mVisualizer = nullptr;
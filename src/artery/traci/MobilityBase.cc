@@ -1,4 +1,7 @@
 #include "artery/traci/MobilityBase.h"
+#include <omnetpp/cexception.h>
+#include <algorithm>
+#include <cmath>
 
 using namespace traci;
 
@@ -7,4 +10,68 @@ namespace artery
 
 omnetpp::simsignal_t MobilityBase::stateChangedSignal = omnetpp::cComponent::registerSignal("mobilityStateChanged");
 
+void MobilityBase::configureInterpolation(const std::string& mode, omnetpp::SimTime horizon)
+{
+    if (mode == "none") {
+        mInterpolation = Interpolation::None;
+    } else if (mode == "linear") {
+        mInterpolation = Interpolation::Linear;
+    } else if (mode == "samples") {
+        mInterpolation = Interpolation::Samples;
+    } else {
+        throw omnetpp::cRuntimeError("unknown mobility interpolation mode \"%s\"", mode.c_str());
+    }
+    mInterpolationHorizon = horizon;
+}
+
+void MobilityBase::recordKinematics(const Position& pos, Angle heading, double speed)
+{
+    const omnetpp::SimTime now = omnetpp::simTime();
+    // an update at the same time replaces the latest sample, default-constructed states are no sample
+    if (mHasLatest && mLatest.time < now) {
+        mPrevious = mLatest;
+        mHasPrevious = true;
+    }
+    mHasLatest = true;
+    mLatest.position = pos;
+    mLatest.heading = heading;
+    mLatest.speed = speed;
+    mLatest.time = now;
+}
+
+MobilityBase::Kinematics MobilityBase::interpolate(omnetpp::SimTime time) const
+{
+    if (mInterpolation == Interpolation::None || time <= mLatest.time) {
+        return mLatest;
+    }
+
+    const double dt = std::min(time - mLatest.time, mInterpolationHorizon).dbl();
+    double turnRate = 0.0;
+    double acceleration = 0.0;
+    double moving = dt;
+    if (mInterpolation == Interpolation::Samples && mHasPrevious) {
+        const double span = (mLatest.time - mPrevious.time).dbl();
+        turnRate = std::remainder(mLatest.heading.radian() - mPrevious.heading.radian(), 2.0 * M_PI) / span;
+        acceleration = (mLatest.speed - mPrevious.speed) / span;
+        if (acceleration < 0.0 && mLatest.speed + acceleration * dt < 0.0) {
+            // vehicle decelerates until it halts within dt, i.e. after v²/(2a), and stands still afterwards
+            moving = std::max(0.0, -mLatest.speed / acceleration);
+        }
+    }
+
+    // move along heading at half-way of turn (circular arc approximated by its chord)
+    const double distance = mLatest.speed * moving + 0.5 * acceleration * moving * moving;
+    const double course = mLatest.heading.radian() + 0.5 * turnRate * moving;
+
+    Kinematics state;
+    state.position = Position {
+        mLatest.position.x.value() + distance * std::cos(course),
+        mLatest.position.y.value() - distance * std::sin(course) // y axis is growing downwards
+    };
+    state.heading = Angle { mLatest.heading.radian() + turnRate * moving };
+    state.speed = std::max(0.0, mLatest.speed + acceleration * moving);
+    state.time = time;
+    return state;
+}
+
 } // namespace artery
@@ -4,7 +4,9 @@
 #include "traci/API.h"
 #include "artery/utility/Geometry.h"
 #include <omnetpp/ccomponent.h>
+#include <omnetpp/simtime.h>
 #include <memory>
+#include <string>
 
 namespace artery
 {
@@ -16,12 +18,60 @@ public:
     static omnetpp::simsignal_t stateChangedSignal;
     virtual const std::string& getId() = 0;
 
+    /**
+     * Estimation of motion state between TraCI updates
+     */
+    enum class Interpolation
+    {
+        None, /*< keep latest TraCI state until next update */
+        Linear, /*< advance along latest heading at latest speed */
+        Samples /*< follow turn rate and acceleration derived from latest two TraCI states */
+    };
+
 protected:
+    /**
+     * Motion state at a particular simulation time
+     */
+    struct Kinematics
+    {
+        Position position;
+        Angle heading;
+        double speed = 0.0;
+        omnetpp::SimTime time;
+    };
+
     virtual void initialize(const Position&, Angle, double speed) = 0;
     virtual void update(const Position&, Angle, double speed) = 0;
 
+    /**
+     * Configure estimation of motion state between TraCI updates
+     * \param mode one of "none", "linear" or "samples"
+     * \param horizon extrapolation does not exceed this time after latest TraCI update
+     */
+    void configureInterpolation(const std::string& mode, omnetpp::SimTime horizon);
+
+    /**
+     * Record motion state reported by TraCI at current simulation time
+     */
+    void recordKinematics(const Position&, Angle, double speed);
+
+    /**
+     * Estimate motion state at given time
+     * \param time not before latest TraCI update
+     * \return latest TraCI state if interpolation is disabled
+     */
+    Kinematics interpolate(omnetpp::SimTime time) const;
+
     std::shared_ptr<traci::API> mTraci;
     traci::Boundary mNetBoundary;
+    Interpolation mInterpolation = Interpolation::None;
+    omnetpp::SimTime mInterpolationHorizon;
+
+private:
+    Kinematics mLatest;
+    Kinematics mPrevious;
+    bool mHasLatest = false;
+    bool mHasPrevious = false;
 };
 
 } // namespace artery
@@ -13,6 +13,7 @@ void VeinsMobility::initialize(int stage)
         WATCH(mPosition);
         WATCH(mDirection);
         WATCH(mSpeed);
+        configureInterpolation(par("interpolation").stdstringValue(), par("interpolationHorizon").doubleValue());
     } else if (stage == 1) {
         mPosition.z = move.getStartPos().z;
         move.setStart(mPosition);
@@ -28,11 +29,23 @@ void VeinsMobility::initialize(const Position& pos, Angle heading, double speed)
     mPosition.x = pos.x / meter;
     mPosition.y = pos.y / meter;
     move.setStart(mPosition);
+    recordKinematics(pos, heading, speed);
 
+    mDirection = veins::Coord { cos(heading.radian()), -sin(heading.radian()) };
     mSpeed = speed;
+    if (mInterpolation == Interpolation::None) {
+        mSpeed = 0.0;
+    } else if (mInterpolation == Interpolation::Samples && !mInterpolationHorizon.isZero()) {
+        // Veins moves linearly: head for the estimated position at the end of the horizon
+        const Kinematics ahead = interpolate(omnetpp::simTime() + mInterpolationHorizon);
+        const veins::Coord chord { ahead.position.x / meter - mPosition.x, ahead.position.y / meter - mPosition.y };
+        const double length = chord.length();
+        if (length > 0.0) {
+            mDirection = chord / length;
+        }
+        mSpeed = length / mInterpolationHorizon.dbl();
+    }
     move.setSpeed(mSpeed);
-
-    mDirection = veins::Coord { cos(heading.radian()), -sin(heading.radian()) };
     move.setDirectionByVector(mDirection);
 }
 
@@ -75,7 +75,12 @@ Core::Core()
         throw omnetpp::cRuntimeError("Creation of ZMQ socket failed: %s", zmq_strerror(errno));
     }
 
+    // do not block at shutdown if OTS has vanished before our last messages have been delivered
+    const int linger = 1000;
+    zmq_setsockopt(m_zmq_socket, ZMQ_LINGER, &linger, sizeof(linger));
+
     m_step_event = new omnetpp::cMessage("OTS step");
+    m_poll_event = new omnetpp::cMessage("OTS poll");
 }
 
 Core::~Core()
@@ -84,6 +89,7 @@ Core::~Core()
         stopSimulation();
     }
     cancelAndDelete(m_step_event);
+    cancelAndDelete(m_poll_event);
 
     if (m_zmq_socket) {
         zmq_close(m_zmq_socket);
@@ -111,6 +117,15 @@ void Core::initialize()
 
     m_stop_time = par("otsRunDuration");
     m_sync_time_notification = par("syncTimeOnNotification");
+    m_pipelined = par("pipelined");
+    if (m_pipelined && m_sync_time_notification) {
+        throw omnetpp::cRuntimeError("pipelined OTS coupling cannot synchronise time on notifications");
+    }
+
+    m_poll_interval = par("pollInterval");
+    if (m_poll_interval > omnetpp::SimTime::ZERO) {
+        scheduleAt(omnetpp::simTime() + m_poll_interval, m_poll_event);
+    }
 }
 
 void Core::handleMessage(omnetpp::cMessage* msg)
@@ -133,17 +148,39 @@ void Core::handleMessage(omnetpp::cMessage* msg)
             emit(lifecycle_signal, true);
         }
 
+        bool advanced = false;
+        if (m_step_requested) {
+            // OTS has been advancing to this step while OMNeT++ processed events
+            completeSimulateUntil();
+            m_step_requested = false;
+            advanced = true;
+        }
+
         if (omnetpp::simTime() < m_stop_time && m_running) {
             // trigger OTS to advance by step length
-            simulateUntil(omnetpp::simTime());
+            if (!advanced) {
+                simulateUntil(omnetpp::simTime());
+            }
             scheduleAt(omnetpp::simTime() + m_step_length, m_step_event);
 
             // request positions of all GTUs at current time step
             requestGtuPositions();
+
+            if (m_pipelined) {
+                // OTS computes next step concurrently, responses are collected at next step event
+                requestSimulateUntil(omnetpp::simTime() + m_step_length);
+                m_step_requested = true;
+            }
         } else {
             // end of OTS simulation reached
             emit(lifecycle_signal, false);
         }
+    } else if (msg == m_poll_event) {
+        // dispatch messages OTS has sent on its own, e.g. radio transmissions
+        processResponses();
+        if (omnetpp::simTime() < m_stop_time && m_running) {
+            scheduleAt(omnetpp::simTime() + m_poll_interval, m_poll_event);
+        }
     }
 }
 
@@ -167,22 +204,24 @@ void Core::unregisterRadio(const RadioEndpoint* radio)
     }
 }
 
-bool Core::receive(std::size_t maxlen, bool block)
+bool Core::receive(bool block)
 {
-    m_buffer.resize(maxlen);
-    int length = zmq_recv(m_zmq_socket, m_buffer.data(), m_buffer.size(), block ? 0 : ZMQ_NOBLOCK);
-    if (length < 0) {
-        if (!block && errno == EAGAIN) {
+    zmq_msg_t msg;
+    zmq_msg_init(&msg);
+    if (zmq_msg_recv(&msg, m_zmq_socket, block ? 0 : ZMQ_DONTWAIT) < 0) {
+        const int error = errno;
+        zmq_msg_close(&msg);
+        if (!block && error == EAGAIN) {
             return false;
         } else {
-            throw omnetpp::cRuntimeError("Receiving from OTS endpoint failed: %s", zmq_strerror(errno));
+            throw omnetpp::cRuntimeError("Receiving from OTS endpoint failed: %s", zmq_strerror(error));
         }
-    } else if (length > m_buffer.size()) {
-        throw omnetpp::cRuntimeError("Length of replied message exceeds buffer size");
-    } else {
-        m_buffer.resize(length);
     }
 
+    // buffer keeps its capacity, i.e. messages are copied without allocation in steady state
+    const auto* data = static_cast<const std::uint8_t*>(zmq_msg_data(&msg));
+    m_buffer.assign(data, data + zmq_msg_size(&msg));
+    zmq_msg_close(&msg);
     return true;
 }
 
@@ -223,15 +262,29 @@ void Core::sendCommand(const sim0mqpp::Identifier& cmd, std::int32_t cmd_id, std
     }
 }
 
+void Core::expectResponse(const sim0mqpp::Identifier& type)
+{
+    ++m_pending[type];
+}
+
 void Core::queryResponses(const sim0mqpp::Identifier& wait_for)
 {
-    m_pending.insert(wait_for);
-    while (receive(8192, !m_pending.empty())) {
+    expectResponse(wait_for);
+    processResponses();
+}
+
+void Core::processResponses()
+{
+    // block while responses are outstanding, then dispatch what has arrived meanwhile
+    while (receive(!m_pending.empty())) {
         sim0mqpp::BufferDeserializer input(m_buffer);
         sim0mqpp::Message msg;
         deserialize(input, msg);
         if (input.good()) {
-            m_pending.erase(msg.message_type_id);
+            auto pending = m_pending.find(msg.message_type_id);
+            if (pending != m_pending.end() && --pending->second == 0) {
+                m_pending.erase(pending);
+            }
 
             if (msg.message_type_id == sim_until_msg) {
                 processSimulationTrigger(msg);
@@ -287,6 +340,7 @@ void Core::processNetwork(const sim0mqpp::Message& msg)
     }
 
     if (*msg_id == 0) {
+        // send all requests at once, replies are collected by the ongoing response processing
         for (const auto& gtu_id : msg.payload) {
             requestGtuPosition(gtu_id);
         }
@@ -319,14 +373,13 @@ void Core::processGtuMove(const sim0mqpp::Message& msg)
     auto accel = msg.get_payload<sim0mqpp::Unit::Acceleration>(5);
 
     if (id && type && pos && pos->values().size() == 3 && heading && speed && accel) {
-        GtuObject gtu;
-        gtu.setId(*id);
-        gtu.setType(*type);
-        gtu.setPosition({ pos->values()[0], pos->values()[1], pos->values()[2] });
-        gtu.setHeadingRad(heading->value());
-        gtu.setSpeed(speed->value());
-        gtu.setAcceleration(accel->value());
-        emit(gtu_position_signal, &gtu);
+        m_gtu.setId(*id);
+        m_gtu.setType(*type);
+        m_gtu.setPosition({ pos->values()[0], pos->values()[1], pos->values()[2] });
+        m_gtu.setHeadingRad(heading->value());
+        m_gtu.setSpeed(speed->value());
+        m_gtu.setAcceleration(accel->value());
+        emit(gtu_position_signal, &m_gtu);
         EV_DETAIL << "GTU position update for ID " << *id << "\n";
     } else {
         EV_ERROR << "received broken GTU position\n";
@@ -365,10 +418,7 @@ void Core::processRadioTransmission(const sim0mqpp::Message& msg)
             radio_msg->setSender(*sender);
             radio_msg->setReceiver(*receiver);
             // skip first three elements (sender, receiver, signal strength)
-            for (std::size_t i = 3; i < msg.payload.size(); ++i)
-            {
-                radio_msg->appendPayload(msg.payload[i]);
-            }
+            radio_msg->setPayload(RadioMessage::Payload { msg.payload.begin() + 3, msg.payload.end() });
             radio_msg->setByteLength(radio_msg->getPayloadLength());
             radio->second->onRadioTransmit(std::move(radio_msg));
         } else {
@@ -458,13 +508,24 @@ void Core::stopSimulation()
 }
 
 void Core::simulateUntil(omnetpp::SimTime time)
+{
+    requestSimulateUntil(time);
+    completeSimulateUntil();
+}
+
+void Core::requestSimulateUntil(omnetpp::SimTime time)
 {
     std::vector<sim0mqpp::Any> payload;
     payload.push_back(sim0mqpp::ScalarQuantity<double> { time.dbl(), sim0mqpp::Unit::Time });
     sendCommand(sim_until_msg, std::move(payload));
-    queryResponses(sim_until_msg); // response only acknowledges intention to advance in time
+    expectResponse(sim_until_msg); // response only acknowledges intention to advance in time
+    m_ots_target = time;
+}
 
-    while (m_ots_time < time && m_running) {
+void Core::completeSimulateUntil()
+{
+    processResponses();
+    while (m_ots_time < m_ots_target && m_running) {
         queryResponses(sim_state_msg); // actual time changes of simulator
     }
 }
@@ -480,7 +541,7 @@ void Core::requestGtuPosition(const sim0mqpp::Any& gtu_id)
     std::vector<sim0mqpp::Any> payload;
     payload.push_back(gtu_id);
     sendCommand(gtu_move_get_current_msg, std::move(payload));
-    queryResponses(gtu_move_msg);
+    expectResponse(gtu_move_msg);
 }
 
 void Core::notifyRadioReception(const RadioMessage& msg)
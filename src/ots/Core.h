@@ -1,12 +1,12 @@
 #ifndef OTS_CORE_QMT3LWQG
 #define OTS_CORE_QMT3LWQG
 
+#include "ots/GtuObject.h"
 #include <omnetpp/csimplemodule.h>
 #include <sim0mqpp/any.hpp>
 #include <sim0mqpp/message.hpp>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
 namespace ots
@@ -37,11 +37,15 @@ protected:
     void startSimulation(const std::string& path);
     void stopSimulation();
     void simulateUntil(omnetpp::SimTime);
+    void requestSimulateUntil(omnetpp::SimTime);
+    void completeSimulateUntil();
     void requestGtuPositions();
     void requestGtuPosition(const sim0mqpp::Any&);
 
-    bool receive(std::size_t maxlen, bool block = true);
+    bool receive(bool block = true);
+    void expectResponse(const sim0mqpp::Identifier&);
     void queryResponses(const sim0mqpp::Identifier&);
+    void processResponses();
     void processNetwork(const sim0mqpp::Message&);
     void processGtuMove(const sim0mqpp::Message&);
     void processGtuAdd(const sim0mqpp::Message&);
@@ -59,14 +63,20 @@ private:
     bool m_network_loaded = false;
     bool m_running = false;
     omnetpp::cMessage* m_step_event = nullptr;
+    omnetpp::cMessage* m_poll_event = nullptr;
     omnetpp::SimTime m_step_length;
+    omnetpp::SimTime m_poll_interval;
     omnetpp::SimTime m_stop_time;
     omnetpp::SimTime m_ots_time;
+    omnetpp::SimTime m_ots_target; /* time requested by latest SIMULATEUNTIL */
+    bool m_pipelined = false;
+    bool m_step_requested = false;
     std::string m_sim_federation;
     std::string m_sim_sender;
     std::string m_sim_receiver;
-    std::vector<std::uint8_t> m_buffer;
-    std::unordered_set<sim0mqpp::Identifier> m_pending;
+    std::vector<std::uint8_t> m_buffer; /* reused for every received message */
+    std::unordered_map<sim0mqpp::Identifier, unsigned> m_pending; /* number of outstanding responses by type */
+    GtuObject m_gtu; /* reused for every GTU move */
     bool m_gtu_add_subscribed = false;
     bool m_gtu_remove_subscribed = false;
     bool m_sim_state_subscribed = false;
@@ -0,0 +1,208 @@
+#include "ots/MockEndpoint.h"
+#include <boost/functional/hash.hpp> // for hashing sim0mq::Identifier's strings
+#include <sim0mqpp/buffer_serialization.hpp>
+#include <sim0mqpp/quantity.hpp>
+#include <zmq.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace ots
+{
+
+Define_Module(MockEndpoint)
+
+namespace
+{
+
+const sim0mqpp::Identifier gtu_move_msg = std::string("GTU move");
+const sim0mqpp::Identifier gtu_move_get_current_msg = std::string("GTU move|GET_CURRENT");
+const sim0mqpp::Identifier gtu_network_msg = std::string("GTUs in network");
+const sim0mqpp::Identifier gtu_network_get_current_msg = std::string("GTUs in network|GET_CURRENT");
+const sim0mqpp::Identifier gtu_network_subscribe_add_msg = std::string("GTUs in network|SUBSCRIBE_TO_ADD");
+const sim0mqpp::Identifier gtu_network_subscribe_remove_msg = std::string("GTUs in network|SUBSCRIBE_TO_REMOVE");
+const sim0mqpp::Identifier radio_receive_msg = std::string("RADIORECEIVE");
+const sim0mqpp::Identifier radio_transmit_msg = std::string("RADIOTRANSMIT");
+const sim0mqpp::Identifier radio_subscribe_change_msg = std::string("RADIOTRANSMIT|SUBSCRIBE_TO_CHANGE");
+const sim0mqpp::Identifier sim_start_msg = std::string("NEWSIMULATION");
+const sim0mqpp::Identifier sim_stop_msg = std::string("DIE");
+const sim0mqpp::Identifier sim_until_msg = std::string("SIMULATEUNTIL");
+const sim0mqpp::Identifier sim_state_msg = std::string("Simulator running");
+const sim0mqpp::Identifier sim_subscribe_change_msg = std::string("Simulator running|SUBSCRIBE_TO_CHANGE");
+
+const char* gtu_prefix = "gtu";
+
+std::vector<sim0mqpp::Any> acknowledge()
+{
+    std::vector<sim0mqpp::Any> payload;
+    payload.push_back(true);
+    payload.push_back(std::string());
+    return payload;
+}
+
+std::int32_t getMessageId(const sim0mqpp::Message& msg)
+{
+    const std::int32_t* id = boost::get<const std::int32_t>(&msg.message_id);
+    return id ? *id : 0;
+}
+
+} // namespace
+
+MockEndpoint::~MockEndpoint()
+{
+    m_stop = true;
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    if (m_zmq_socket) {
+        zmq_close(m_zmq_socket);
+    }
+
+    if (m_zmq_context) {
+        zmq_ctx_term(m_zmq_context);
+    }
+}
+
+void MockEndpoint::initialize()
+{
+    m_gtu_type = par("gtuType").stdstringValue();
+    m_ring_radius = par("ringRadius");
+    m_speed = par("speed");
+    const int gtus = par("numGtus");
+    for (int i = 0; i < gtus; ++i) {
+        m_gtu_ids.push_back(gtu_prefix + std::to_string(i));
+    }
+
+    m_zmq_context = zmq_ctx_new();
+    if (!m_zmq_context) {
+        throw omnetpp::cRuntimeError("Creation of ZMQ context failed: %s", zmq_strerror(errno));
+    }
+
+    m_zmq_socket = zmq_socket(m_zmq_context, ZMQ_PAIR);
+    if (!m_zmq_socket) {
+        throw omnetpp::cRuntimeError("Creation of ZMQ socket failed: %s", zmq_strerror(errno));
+    }
+
+    const int linger = 0;
+    zmq_setsockopt(m_zmq_socket, ZMQ_LINGER, &linger, sizeof(linger));
+    if (zmq_bind(m_zmq_socket, par("endpoint").stringValue()) != 0) {
+        throw omnetpp::cRuntimeError("Binding mock OTS endpoint failed: %s", zmq_strerror(errno));
+    }
+
+    m_thread = std::thread(&MockEndpoint::serve, this);
+}
+
+void MockEndpoint::serve()
+{
+    while (!m_stop) {
+        zmq_pollitem_t item { m_zmq_socket, 0, ZMQ_POLLIN, 0 };
+        if (zmq_poll(&item, 1, 100) <= 0) {
+            continue;
+        }
+
+        zmq_msg_t frame;
+        zmq_msg_init(&frame);
+        if (zmq_msg_recv(&frame, m_zmq_socket, 0) >= 0) {
+            const auto* data = static_cast<const std::uint8_t*>(zmq_msg_data(&frame));
+            m_buffer.assign(data, data + zmq_msg_size(&frame));
+        } else {
+            m_buffer.clear();
+        }
+        zmq_msg_close(&frame);
+
+        sim0mqpp::BufferDeserializer input(m_buffer);
+        sim0mqpp::Message msg;
+        deserialize(input, msg);
+        if (input.good() && !process(msg)) {
+            break;
+        }
+    }
+}
+
+bool MockEndpoint::process(const sim0mqpp::Message& msg)
+{
+    const auto& type = msg.message_type_id;
+    if (type == sim_stop_msg) {
+        return false;
+    } else if (type == sim_until_msg) {
+        auto until = msg.get_payload<sim0mqpp::Unit::Time>(0);
+        send(msg, sim_until_msg, getMessageId(msg), acknowledge());
+        if (until && m_state_subscription) {
+            for (bool running : { true, false }) {
+                if (!running) {
+                    m_time = std::max(m_time, until->value());
+                }
+                std::vector<sim0mqpp::Any> payload;
+                payload.push_back(sim0mqpp::ScalarQuantity<double> { m_time, sim0mqpp::Unit::Time });
+                payload.push_back(running);
+                send(msg, sim_state_msg, *m_state_subscription, std::move(payload));
+            }
+        }
+    } else if (type == gtu_network_get_current_msg) {
+        send(msg, gtu_network_msg, getMessageId(msg), std::vector<sim0mqpp::Any>(m_gtu_ids));
+    } else if (type == gtu_move_get_current_msg) {
+        auto id = msg.get_payload<std::string>(0);
+        if (id) {
+            send(msg, gtu_move_msg, getMessageId(msg), getGtuMove(*id));
+        }
+    } else if (type == sim_start_msg) {
+        send(msg, sim_start_msg, getMessageId(msg), acknowledge());
+    } else if (type == gtu_network_subscribe_add_msg) {
+        send(msg, gtu_network_msg, getMessageId(msg), acknowledge());
+        // all GTUs enter the network at once
+        for (const auto& id : m_gtu_ids) {
+            std::vector<sim0mqpp::Any> payload;
+            payload.push_back(sim0mqpp::ScalarQuantity<double> { m_time, sim0mqpp::Unit::Time });
+            payload.push_back(id);
+            send(msg, gtu_network_msg, getMessageId(msg), std::move(payload));
+        }
+    } else if (type == gtu_network_subscribe_remove_msg) {
+        send(msg, gtu_network_msg, getMessageId(msg), acknowledge());
+    } else if (type == sim_subscribe_change_msg) {
+        send(msg, sim_state_msg, getMessageId(msg), acknowledge());
+        m_state_subscription = getMessageId(msg);
+    } else if (type == radio_subscribe_change_msg) {
+        send(msg, radio_transmit_msg, getMessageId(msg), acknowledge());
+    }
+    // radio receptions and unknown messages are silently ignored (logging is not thread-safe)
+    return true;
+}
+
+std::vector<sim0mqpp::Any> MockEndpoint::getGtuMove(const std::string& id) const
+{
+    // GTUs are evenly spaced on the ring and drive counter-clockwise
+    const double index = std::stod(id.substr(std::strlen(gtu_prefix)));
+    const double circumference = 2.0 * M_PI * m_ring_radius;
+    const double distance = index * circumference / m_gtu_ids.size() + m_speed * m_time;
+    const double angle = distance / m_ring_radius;
+
+    std::vector<sim0mqpp::Any> payload;
+    payload.push_back(id);
+    payload.push_back(m_gtu_type);
+    payload.push_back(sim0mqpp::VectorQuantity<double> {
+        std::vector<double> { m_ring_radius * std::cos(angle), m_ring_radius * std::sin(angle), 0.0 },
+        sim0mqpp::Unit::Position });
+    payload.push_back(sim0mqpp::ScalarQuantity<double> { std::remainder(angle + 0.5 * M_PI, 2.0 * M_PI), sim0mqpp::Unit::Direction });
+    payload.push_back(sim0mqpp::ScalarQuantity<double> { m_speed, sim0mqpp::Unit::Speed });
+    payload.push_back(sim0mqpp::ScalarQuantity<double> { 0.0, sim0mqpp::Unit::Acceleration });
+    return payload;
+}
+
+void MockEndpoint::send(const sim0mqpp::Message& request, const sim0mqpp::Identifier& type, std::int32_t id, std::vector<sim0mqpp::Any>&& payload)
+{
+    sim0mqpp::Message msg;
+    msg.federation_id = request.federation_id;
+    msg.sender_id = request.receiver_id;
+    msg.receiver_id = request.sender_id;
+    msg.message_type_id = type;
+    msg.message_id = id;
+    msg.payload = std::move(payload);
+
+    sim0mqpp::Buffer buffer;
+    sim0mqpp::BufferSerializer output(buffer);
+    sim0mqpp::serialize(output, msg);
+    zmq_send(m_zmq_socket, buffer.data(), buffer.size(), 0);
+}
+
+} // namespace ots
@@ -0,0 +1,54 @@
+#ifndef OTS_MOCKENDPOINT_H_W2N8ZKVD
+#define OTS_MOCKENDPOINT_H_W2N8ZKVD
+
+#include <omnetpp/csimplemodule.h>
+#include <sim0mqpp/any.hpp>
+#include <sim0mqpp/message.hpp>
+#include <boost/optional/optional.hpp>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ots
+{
+
+/**
+ * MockEndpoint serves the OTS side of the sim0mq protocol in a background thread
+ *
+ * GTUs drive at constant speed along a ring road, i.e. no OTS installation is required.
+ * This allows benchmarking and testing ots::Core without OTS computation times.
+ */
+class MockEndpoint : public omnetpp::cSimpleModule
+{
+public:
+    MockEndpoint() = default;
+    virtual ~MockEndpoint();
+
+    void initialize() override;
+
+private:
+    void serve();
+    bool process(const sim0mqpp::Message&);
+    void send(const sim0mqpp::Message& request, const sim0mqpp::Identifier& type, std::int32_t id, std::vector<sim0mqpp::Any>&& payload);
+    std::vector<sim0mqpp::Any> getGtuMove(const std::string& id) const;
+
+    void* m_zmq_context = nullptr;
+    void* m_zmq_socket = nullptr;
+    std::thread m_thread;
+    std::atomic<bool> m_stop { false };
+
+    // following members are accessed by server thread only after initialization
+    std::vector<std::uint8_t> m_buffer;
+    std::vector<sim0mqpp::Any> m_gtu_ids;
+    std::string m_gtu_type;
+    double m_ring_radius = 0.0;
+    double m_speed = 0.0;
+    double m_time = 0.0;
+    boost::optional<std::int32_t> m_state_subscription;
+};
+
+} // namespace ots
+
+#endif /* OTS_MOCKENDPOINT_H_W2N8ZKVD */
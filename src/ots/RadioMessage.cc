@@ -29,29 +29,53 @@ const std::string& RadioMessage::getReceiver() const
     return mReceiver;
 }
 
-void RadioMessage::setPayload(std::vector<sim0mqpp::Any> payload)
+void RadioMessage::setPayload(Payload payload)
+{
+    auto writable = std::make_shared<Payload>(std::move(payload));
+    setPayload(writable);
+    mWritablePayload = writable.get();
+}
+
+void RadioMessage::setPayload(std::shared_ptr<const Payload> payload)
 {
     mPayload = std::move(payload);
+    mWritablePayload = nullptr;
+    mPayloadLengthValid = false;
 }
 
 void RadioMessage::appendPayload(const sim0mqpp::Any& element)
 {
-    mPayload.push_back(element);
+    if (!mWritablePayload || mPayload.use_count() > 1) {
+        // copy-on-write: other messages share the current payload
+        setPayload(mPayload ? Payload(*mPayload) : Payload());
+    }
+    mWritablePayload->push_back(element);
+    mPayloadLengthValid = false;
+}
+
+const RadioMessage::Payload& RadioMessage::getPayload() const
+{
+    static const Payload empty;
+    return mPayload ? *mPayload : empty;
 }
 
-const std::vector<sim0mqpp::Any>& RadioMessage::getPayload() const
+std::shared_ptr<const RadioMessage::Payload> RadioMessage::getSharedPayload() const
 {
     return mPayload;
 }
 
 std::size_t RadioMessage::getPayloadLength() const
 {
-    sim0mqpp::CounterSerializer output;
-    for (const auto& elem : mPayload)
-    {
-        sim0mqpp::serialize(output, elem);
+    if (!mPayloadLengthValid) {
+        sim0mqpp::CounterSerializer output;
+        for (const auto& elem : getPayload())
+        {
+            sim0mqpp::serialize(output, elem);
+        }
+        mPayloadLength = output.counter();
+        mPayloadLengthValid = true;
     }
-    return output.counter();
+    return mPayloadLength;
 }
 
 } // namespace ots
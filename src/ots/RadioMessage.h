@@ -3,15 +3,24 @@
 
 #include <omnetpp/cpacket.h>
 #include <sim0mqpp/any.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace ots
 {
 
+/**
+ * RadioMessage carries a radio transmission requested by OTS
+ *
+ * The payload is shared among all duplicates of a message, e.g. created by the radio medium
+ * for each receiver. Modifications copy the payload first if it is shared (copy-on-write).
+ * Payloads owned by a single message and not handed in as const are modified in place.
+ */
 class RadioMessage : public omnetpp::cPacket
 {
 public:
+    using Payload = std::vector<sim0mqpp::Any>;
     using omnetpp::cPacket::cPacket;
 
     void setSender(const std::string&);
@@ -20,9 +29,16 @@ public:
     void setReceiver(const std::string&);
     const std::string& getReceiver() const;
 
-    void setPayload(std::vector<sim0mqpp::Any>);
+    void setPayload(Payload);
+    void setPayload(std::shared_ptr<const Payload>);
     void appendPayload(const sim0mqpp::Any&);
-    const std::vector<sim0mqpp::Any>& getPayload() const;
+    const Payload& getPayload() const;
+    std::shared_ptr<const Payload> getSharedPayload() const;
+
+    /**
+     * Get serialized length of payload
+     * \return number of bytes, computed once per payload
+     */
     std::size_t getPayloadLength() const;
 
     omnetpp::cPacket* dup() const override;
@@ -30,7 +46,10 @@ public:
 private:
     std::string mSender;
     std::string mReceiver;
-    std::vector<sim0mqpp::Any> mPayload;
+    std::shared_ptr<const Payload> mPayload;
+    Payload* mWritablePayload = nullptr; /*< mPayload if allocated as mutable by a message */
+    mutable std::size_t mPayloadLength = 0;
+    mutable bool mPayloadLengthValid = false;
 };
 
 } // namespace ots
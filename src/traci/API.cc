@@ -1,10 +1,28 @@
 #include "traci/API.h"
+#include "traci/InProcessBackend.h"
 #include "traci/Launcher.h"
-#include <thread>
+#include "traci/TraceConnection.h"
+#include <utility>
 
 namespace traci
 {
 
+API::API() = default;
+
+API::~API()
+{
+    if (m_receiver.joinable()) {
+        {
+            // do not close socket while background thread is still receiving
+            std::unique_lock<std::mutex> lock(m_step_mutex);
+            m_step_condition.wait(lock, [this] { return m_step_state != StepState::Pending; });
+            m_stop_receiver = true;
+        }
+        m_step_condition.notify_all();
+        m_receiver.join();
+    }
+}
+
 TraCIGeoPosition API::convertGeo(const TraCIPosition& pos) const
 {
     libsumo::TraCIPosition result = simulation.convertGeo(pos.x, pos.y, false);
@@ -21,6 +39,16 @@ TraCIPosition API::convert2D(const TraCIGeoPosition& pos) const
 
 void API::connect(const ServerEndpoint& endpoint)
 {
+    if (endpoint.backend) {
+        m_backend = endpoint.backend();
+        myBackend = m_backend.get();
+        return;
+    } else if (endpoint.connection) {
+        mySocket = endpoint.connection().release();
+        TraCIAPI::setOrder(endpoint.clientId);
+        return;
+    }
+
     const unsigned max_tries = endpoint.retry ? 10 : 0;
     unsigned tries = 0;
     auto sleep = std::chrono::milliseconds(500);
@@ -41,4 +69,287 @@ void API::connect(const ServerEndpoint& endpoint)
     }
 }
 
+void API::recordTrace(const std::string& path)
+{
+    if (!mySocket) {
+        throw libsumo::TraCIException("TraCI connection required for trace recording");
+    }
+    mySocket = new RecordingConnection(std::unique_ptr<tcpip::Socket> { mySocket }, path);
+}
+
+/**
+ * Decoder target storing results in TraCIAPI's scopes unless delegate target provides storage
+ *
+ * Results of simulation steps are staged in API's buffers and handed over to the scopes on commit.
+ */
+class API::ScopeTarget : public SubscriptionDecoder::Target
+{
+public:
+    ScopeTarget(API& api, SubscriptionDecoder::Target* delegate, bool staged) :
+        m_api(api), m_delegate(delegate), m_staged(staged) {}
+
+    void prepareDecoding() override
+    {
+        if (m_staged) {
+            m_api.m_staged_results.clear();
+            m_api.m_staged_context_results.clear();
+        }
+        if (m_delegate) {
+            m_delegate->prepareDecoding();
+        }
+    }
+
+    void commitDecoding() override
+    {
+        for (auto& domain : m_api.myDomains) {
+            domain.second->clearSubscriptionResults();
+        }
+        for (auto& results : m_api.m_staged_results) {
+            std::swap(m_api.myDomains.at(results.first)->getModifiableSubscriptionResults(), results.second);
+        }
+        for (auto& contexts : m_api.m_staged_context_results) {
+            auto* domain = m_api.myDomains.at(contexts.first);
+            for (auto& results : contexts.second) {
+                std::swap(domain->getModifiableContextSubscriptionResults(results.first), results.second);
+            }
+        }
+        if (m_delegate) {
+            m_delegate->commitDecoding();
+        }
+    }
+
+    SubscriptionDecoder::Results getVariableResults(int response, const std::string& id) override
+    {
+        SubscriptionDecoder::Results results;
+        if (m_delegate) {
+            results = m_delegate->getVariableResults(response, id);
+        }
+        if (!results.values) {
+            if (m_staged) {
+                results.values = &m_api.m_staged_results[response][id];
+            } else {
+                results.values = &m_api.myDomains.at(response)->getModifiableSubscriptionResults()[id];
+            }
+        }
+        return results;
+    }
+
+    SubscriptionDecoder::Results getContextResults(int response, const std::string& context, const std::string& id) override
+    {
+        SubscriptionDecoder::Results results;
+        if (m_delegate) {
+            results = m_delegate->getContextResults(response, context, id);
+        }
+        if (!results.values) {
+            if (m_staged) {
+                results.values = &m_api.m_staged_context_results[response][context][id];
+            } else {
+                results.values = &m_api.myDomains.at(response)->getModifiableContextSubscriptionResults(context)[id];
+            }
+        }
+        return results;
+    }
+
+private:
+    API& m_api;
+    SubscriptionDecoder::Target* m_delegate;
+    bool m_staged;
+};
+
+void API::simulationStep(double time)
+{
+    completeSimulationStep();
+
+    using clock = std::chrono::steady_clock;
+    m_step_timing = StepTiming {};
+    const auto start = clock::now();
+    sendSimulationStep(time);
+    const auto sent = clock::now();
+    receiveSimulationStep();
+    m_step_timing.send = sent - start;
+    m_step_timing.wait = clock::now() - sent;
+    decodeSimulationStep();
+    commitSimulationStep();
+}
+
+void API::requestSimulationStep(double time)
+{
+    completeSimulationStep();
+
+    using clock = std::chrono::steady_clock;
+    m_step_timing = StepTiming {};
+    const auto start = clock::now();
+    sendSimulationStep(time);
+    m_step_timing.send = clock::now() - start;
+
+    {
+        std::lock_guard<std::mutex> lock(m_step_mutex);
+        m_step_state = StepState::Pending;
+    }
+    if (m_receiver.joinable()) {
+        m_step_condition.notify_all();
+    } else {
+        // one thread serves all steps, it waits for the next request in between
+        m_receiver = std::thread(&API::runReceiver, this);
+    }
+}
+
+void API::completeSimulationStep()
+{
+    std::unique_lock<std::mutex> lock(m_step_mutex);
+    if (m_step_state == StepState::Idle) {
+        return;
+    }
+
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    m_step_condition.wait(lock, [this] { return m_step_state != StepState::Pending; });
+    m_step_timing.wait = clock::now() - start;
+    m_step_state = StepState::Idle;
+    std::exception_ptr error = std::exchange(m_step_error, nullptr);
+    lock.unlock();
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    commitSimulationStep();
+}
+
+void API::awaitSimulationStep() const
+{
+    std::unique_lock<std::mutex> lock(m_step_mutex);
+    m_step_condition.wait(lock, [this] { return m_step_state != StepState::Pending; });
+}
+
+void API::subscribeObjects(int command, const std::vector<std::string>& ids, const std::vector<int>& vars)
+{
+    if (ids.empty()) {
+        return;
+    } else if (m_backend) {
+        prepareRequest();
+        ScopeTarget target(*this, m_subscription_target, false);
+        m_backend->subscribeObjects(command, ids, vars, target);
+        return;
+    } else if (mySocket == nullptr) {
+        throw tcpip::SocketException("Socket is not initialised");
+    }
+
+    // same command layout as TraCIAPI::send_commandSubscribeObjectVariable
+    tcpip::Storage request;
+    for (const std::string& id : ids) {
+        request.writeUnsignedByte(0);
+        request.writeInt(5 + 1 + 8 + 8 + 4 + (int) id.length() + 1 + (int) vars.size());
+        request.writeUnsignedByte(command);
+        request.writeDouble(libsumo::INVALID_DOUBLE_VALUE);
+        request.writeDouble(libsumo::INVALID_DOUBLE_VALUE);
+        request.writeString(id);
+        request.writeUnsignedByte((int) vars.size());
+        for (int var : vars) {
+            request.writeUnsignedByte(var);
+        }
+    }
+    prepareRequest();
+    mySocket->sendExact(request);
+
+    tcpip::Storage response;
+    mySocket->receiveExact(response);
+    if (response.size() > 0) {
+        ScopeTarget target(*this, m_subscription_target, false);
+        m_decoder.decodeSubscriptions(&*response.begin(), response.size(), command, ids.size(), !vars.empty(), target);
+    } else {
+        throw libsumo::TraCIException("empty response to subscription commands");
+    }
+}
+
+void API::setSubscriptionTarget(SubscriptionDecoder::Target* target)
+{
+    awaitSimulationStep();
+    m_subscription_target = target;
+}
+
+bool API::hasPendingSimulationStep() const
+{
+    std::lock_guard<std::mutex> lock(m_step_mutex);
+    return m_step_state != StepState::Idle;
+}
+
+void API::prepareRequest() const
+{
+    std::unique_lock<std::mutex> lock(m_step_mutex);
+    if (m_step_state == StepState::Pending) {
+        ++m_interrupted_steps;
+        m_step_condition.wait(lock, [this] { return m_step_state != StepState::Pending; });
+    }
+}
+
+void API::runReceiver()
+{
+    std::unique_lock<std::mutex> lock(m_step_mutex);
+    while (true) {
+        m_step_condition.wait(lock, [this] { return m_step_state == StepState::Pending || m_stop_receiver; });
+        if (m_stop_receiver) {
+            break;
+        }
+
+        lock.unlock();
+        std::exception_ptr error;
+        try {
+            receiveSimulationStep();
+            decodeSimulationStep();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        lock.lock();
+
+        m_step_error = error;
+        m_step_state = StepState::Received;
+        m_step_condition.notify_all();
+    }
+}
+
+void API::sendSimulationStep(double time)
+{
+    if (m_backend) {
+        m_step_time = time;
+    } else {
+        send_commandSimulationStep(time);
+    }
+}
+
+void API::receiveSimulationStep()
+{
+    if (m_backend) {
+        m_backend->simulationStep(m_step_time);
+        return;
+    }
+
+    // same as TraCIAPI::simulationStep but without sending the request, decoding is deferred
+    m_step_response.reset();
+    check_resultState(m_step_response, libsumo::CMD_SIMSTEP);
+}
+
+void API::decodeSimulationStep()
+{
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    ScopeTarget target(*this, m_subscription_target, true);
+    target.prepareDecoding();
+    const auto prepared = clock::now();
+
+    const std::size_t position = m_step_response.position();
+    if (m_backend) {
+        m_backend->readSubscriptions(target);
+    } else if (position < m_step_response.size()) {
+        m_step_decoder.decodeStep(&*m_step_response.begin() + position, m_step_response.size() - position, target);
+    }
+    m_step_timing.reset = prepared - start;
+    m_step_timing.decode = clock::now() - prepared;
+}
+
+void API::commitSimulationStep()
+{
+    ScopeTarget target(*this, m_subscription_target, true);
+    target.commitDecoding();
+}
+
 } // namespace traci
@@ -6,12 +6,21 @@
 #include "traci/Boundary.h"
 #include "traci/GeoPosition.h"
 #include "traci/Position.h"
+#include "traci/SubscriptionDecoder.h"
 #include "traci/Time.h"
 #include <omnetpp/simtime.h>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace traci
 {
 
+class InProcessBackend;
 class ServerEndpoint;
 
 class API : public TraCIAPI
@@ -19,10 +28,142 @@ class API : public TraCIAPI
 public:
     using Version = std::pair<int, std::string>;
 
+    /**
+     * Durations of the latest simulation step's phases measured by a monotonic clock
+     */
+    struct StepTiming
+    {
+        using Duration = std::chrono::steady_clock::duration;
+        Duration send = Duration::zero(); /*< writing the step request */
+        Duration wait = Duration::zero(); /*< blocking until the step response has been received */
+        Duration reset = Duration::zero(); /*< preparing subscription target, i.e. resetting caches */
+        Duration decode = Duration::zero(); /*< decoding subscription results */
+    };
+
+    API();
+    ~API();
+
     TraCIGeoPosition convertGeo(const TraCIPosition&) const;
     TraCIPosition convert2D(const TraCIGeoPosition&) const;
 
     void connect(const ServerEndpoint&);
+
+    /**
+     * Record all following TraCI messages of this connection for replay by ReplayLauncher
+     * \param path trace file path
+     */
+    void recordTrace(const std::string& path);
+
+    /**
+     * Perform a simulation step and decode its subscription results
+     *
+     * Results are stored by the subscription target (if set) or in the scopes' subscription results.
+     * This shadows TraCIAPI::simulationStep for the sake of faster decoding.
+     * A pending simulation step is completed first.
+     *
+     * \param time target time of simulation step (0 for a single step)
+     */
+    void simulationStep(double time = 0.0);
+
+    /**
+     * Request a simulation step without waiting for the TraCI server's response.
+     *
+     * The response is received and decoded by a persistent background thread. Decoded values are
+     * staged, i.e. caches and scopes keep serving the current step's values until completeSimulationStep.
+     * Any other request sent meanwhile waits for the pending step's reception first, and it is answered
+     * by the TraCI server according to the upcoming step's state.
+     *
+     * \param time target time of simulation step (0 for a single step)
+     */
+    void requestSimulationStep(double time = 0.0);
+
+    /**
+     * Wait for completion of a pending simulation step (if any) and make its subscription results current
+     */
+    void completeSimulationStep();
+
+    /**
+     * Wait until a pending simulation step (if any) has been received and decoded in the background
+     *
+     * Decoded values stay staged, i.e. this only ensures that the subscription target is not accessed concurrently.
+     */
+    void awaitSimulationStep() const;
+
+    /**
+     * Subscribe variables of many objects by a single TraCI message
+     *
+     * Unlike TraCIScopeWrapper::subscribe, all subscription commands are sent at once and their
+     * responses are received in bulk, i.e. there is only one round trip regardless of the number of objects.
+     * Initial values are stored like step results by the subscription target (if set) or in the scopes' subscription results.
+     *
+     * \param command variable subscription command of a domain, e.g. CMD_SUBSCRIBE_VEHICLE_VARIABLE
+     * \param ids identifiers of subscribed objects
+     * \param vars subscribed variables, empty list cancels subscriptions
+     */
+    void subscribeObjects(int command, const std::vector<std::string>& ids, const std::vector<int>& vars);
+
+    /**
+     * Set target for decoded subscription results
+     *
+     * Objects not handled by the target are stored in the scopes' subscription results.
+     * \param target storage lookup, nullptr resets to scopes' subscription results only
+     */
+    void setSubscriptionTarget(SubscriptionDecoder::Target* target);
+
+    /**
+     * Check if a simulation step has been requested but not completed yet
+     */
+    bool hasPendingSimulationStep() const;
+
+    /**
+     * Number of pending simulation steps completed prematurely because of interleaved requests
+     */
+    unsigned long getInterruptedSimulationSteps() const { return m_interrupted_steps; }
+
+    /**
+     * Get timing of latest simulation step
+     *
+     * In pipelined mode, waiting covers only the time blocked by completeSimulationStep.
+     */
+    const StepTiming& getStepTiming() const { return m_step_timing; }
+
+protected:
+    void prepareRequest() const override;
+
+private:
+    class ScopeTarget;
+
+    enum class StepState { Idle, Pending, Received };
+
+    // staged subscription results without storage of subscription target, indexed by response command
+    using StagedResults = std::map<int, libsumo::SubscriptionResults>;
+    using StagedContextResults = std::map<int, libsumo::ContextSubscriptionResults>;
+
+    void runReceiver();
+    void sendSimulationStep(double time);
+    void receiveSimulationStep();
+    void decodeSimulationStep();
+    void commitSimulationStep();
+
+    // background thread receiving and decoding pipelined simulation steps
+    std::thread m_receiver;
+    mutable std::mutex m_step_mutex;
+    mutable std::condition_variable m_step_condition;
+    StepState m_step_state = StepState::Idle;
+    bool m_stop_receiver = false;
+    std::exception_ptr m_step_error;
+
+    mutable unsigned long m_interrupted_steps = 0;
+    // serves requests instead of TraCI connection if set, requested steps are performed when received
+    std::unique_ptr<InProcessBackend> m_backend;
+    double m_step_time = 0.0;
+    tcpip::Storage m_step_response;
+    SubscriptionDecoder m_decoder;
+    SubscriptionDecoder m_step_decoder;
+    SubscriptionDecoder::Target* m_subscription_target = nullptr;
+    StagedResults m_staged_results;
+    StagedContextResults m_staged_context_results;
+    StepTiming m_step_timing;
 };
 
 } // namespace traci
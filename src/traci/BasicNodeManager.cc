@@ -7,6 +7,7 @@
 #include "traci/VariableCache.h"
 #include "traci/VehicleSink.h"
 #include <inet/common/ModuleAccess.h>
+#include <chrono>
 
 using namespace omnetpp;
 
@@ -32,6 +33,7 @@ public:
     VehicleObjectImpl(std::shared_ptr<VehicleCache> cache) : m_cache(cache) {}
 
     std::shared_ptr<VehicleCache> getCache() const override { return m_cache; }
+    IdInterner::Handle getHandle() const override { return m_cache->getHandle(); }
     const TraCIPosition& getPosition() const override { return m_cache->get<libsumo::VAR_POSITION>(); }
     TraCIAngle getHeading() const override { return TraCIAngle { m_cache->get<libsumo::VAR_ANGLE>() }; }
     double getSpeed() const override { return m_cache->get<libsumo::VAR_SPEED>(); }
@@ -46,6 +48,7 @@ public:
     PersonObjectImpl(std::shared_ptr<PersonCache> cache) : m_cache(cache) {}
 
     std::shared_ptr<PersonCache> getCache() const override { return m_cache; }
+    IdInterner::Handle getHandle() const override { return m_cache->getHandle(); }
     const TraCIPosition& getPosition() const override { return m_cache->get<libsumo::VAR_POSITION>(); }
     TraCIAngle getHeading() const override { return TraCIAngle { m_cache->get<libsumo::VAR_ANGLE>() }; }
     double getSpeed() const override { return m_cache->get<libsumo::VAR_SPEED>(); }
@@ -68,7 +71,9 @@ const simsignal_t BasicNodeManager::updatePersonSignal = cComponent::registerSig
 const simsignal_t BasicNodeManager::removePersonSignal = cComponent::registerSignal("traci.person.remove");
 const simsignal_t BasicNodeManager::addVehicleSignal = cComponent::registerSignal("traci.vehicle.add");
 const simsignal_t BasicNodeManager::updateVehicleSignal = cComponent::registerSignal("traci.vehicle.update");
+const simsignal_t BasicNodeManager::updateVehiclesSignal = cComponent::registerSignal("traci.vehicles.update");
 const simsignal_t BasicNodeManager::removeVehicleSignal = cComponent::registerSignal("traci.vehicle.remove");
+const simsignal_t BasicNodeManager::updateTimeSignal = cComponent::registerSignal("traciNodeUpdateTime");
 
 void BasicNodeManager::initialize()
 {
@@ -119,11 +124,13 @@ void BasicNodeManager::traciInit()
 
 void BasicNodeManager::traciStep()
 {
+    const auto start = std::chrono::steady_clock::now();
     processVehicles();
     if (!m_ignore_persons) {
         processPersons();
     }
     emit(updateNodeSignal, getNumberOfNodes());
+    emit(updateTimeSignal, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
 }
 
 void BasicNodeManager::traciClose()
@@ -158,6 +165,10 @@ void BasicNodeManager::processVehicles()
         }
     }
 
+    if (mayHaveListeners(updateVehiclesSignal)) {
+        emitVehicleSnapshot();
+    }
+
     for (auto& vehicle : m_vehicles) {
         const std::string& id = vehicle.first;
         VehicleSink* sink = vehicle.second;
@@ -165,13 +176,38 @@ void BasicNodeManager::processVehicles()
     }
 }
 
+void BasicNodeManager::emitVehicleSnapshot()
+{
+    m_vehicle_states.clear();
+    m_vehicle_states.reserve(m_vehicles.size());
+    for (auto& vehicle : m_vehicles) {
+        auto cache = m_subscriptions->getVehicleCache(vehicle.first);
+        VehicleState state;
+        state.handle = cache->getHandle();
+        state.position = cache->get<libsumo::VAR_POSITION>();
+        state.heading = TraCIAngle { cache->get<libsumo::VAR_ANGLE>() };
+        state.speed = cache->get<libsumo::VAR_SPEED>();
+        // dimensions are stored by departure subscription and kept by cache
+        state.length = cache->get<libsumo::VAR_LENGTH>();
+        state.width = cache->get<libsumo::VAR_WIDTH>();
+        state.height = cache->get<libsumo::VAR_HEIGHT>();
+        m_vehicle_states.push_back(state);
+    }
+
+    VehicleSnapshot snapshot(m_subscriptions->getVehicleIds(), m_vehicle_states);
+    emit(updateVehiclesSignal, &snapshot);
+}
+
 void BasicNodeManager::addVehicle(const std::string& id)
 {
     NodeInitializer init = [this, &id](cModule* module) {
+        // initial state is taken from subscription results (if available) instead of separate queries
         VehicleSink* vehicle = getVehicleSink(module);
-        auto& traci = m_api->vehicle;
-        vehicle->initializeSink(m_api, m_subscriptions->getVehicleCache(id), m_boundary);
-        vehicle->initializeVehicle(traci.getPosition(id), TraCIAngle { traci.getAngle(id) }, traci.getSpeed(id));
+        auto cache = m_subscriptions->getVehicleCache(id);
+        vehicle->initializeSink(m_api, cache, m_boundary);
+        vehicle->initializeVehicle(cache->get<libsumo::VAR_POSITION>(),
+                TraCIAngle { cache->get<libsumo::VAR_ANGLE>() },
+                cache->get<libsumo::VAR_SPEED>());
         m_vehicles[id] = vehicle;
     };
 
@@ -229,10 +265,13 @@ void BasicNodeManager::processPersons()
 void BasicNodeManager::addPerson(const std::string& id)
 {
     NodeInitializer init = [this, &id](cModule* module) {
+        // initial state is taken from subscription results (if available) instead of separate queries
         PersonSink* person = getPersonSink(module);
-        auto& traci = m_api->person;
-        person->initializeSink(m_api, m_subscriptions->getPersonCache(id), m_boundary);
-        person->initializePerson(traci.getPosition(id), TraCIAngle { traci.getAngle(id) }, traci.getSpeed(id));
+        auto cache = m_subscriptions->getPersonCache(id);
+        person->initializeSink(m_api, cache, m_boundary);
+        person->initializePerson(cache->get<libsumo::VAR_POSITION>(),
+                TraCIAngle { cache->get<libsumo::VAR_ANGLE>() },
+                cache->get<libsumo::VAR_SPEED>());
         m_persons[id] = person;
     };
 
@@ -3,6 +3,7 @@
 
 #include "traci/Angle.h"
 #include "traci/Boundary.h"
+#include "traci/IdInterner.h"
 #include "traci/NodeManager.h"
 #include "traci/Listener.h"
 #include "traci/Position.h"
@@ -13,6 +14,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace traci
 {
@@ -34,7 +36,9 @@ public:
     static const omnetpp::simsignal_t removePersonSignal;
     static const omnetpp::simsignal_t addVehicleSignal;
     static const omnetpp::simsignal_t updateVehicleSignal;
+    static const omnetpp::simsignal_t updateVehiclesSignal;
     static const omnetpp::simsignal_t removeVehicleSignal;
+    static const omnetpp::simsignal_t updateTimeSignal;
 
     std::shared_ptr<API> getAPI() override { return m_api; }
     SubscriptionManager* getSubscriptions() { return m_subscriptions; }
@@ -49,15 +53,51 @@ public:
     {
     public:
         virtual std::shared_ptr<VehicleCache> getCache() const = 0;
+        virtual IdInterner::Handle getHandle() const = 0;
         virtual const TraCIPosition& getPosition() const = 0;
         virtual TraCIAngle getHeading() const = 0;
         virtual double getSpeed() const = 0;
     };
 
+    /**
+     * VehicleState is a vehicle's entry in a VehicleSnapshot
+     */
+    struct VehicleState
+    {
+        IdInterner::Handle handle;
+        TraCIPosition position;
+        TraCIAngle heading { 0.0 };
+        double speed;
+        double length;
+        double width;
+        double height;
+    };
+
+    /**
+     * VehicleSnapshot lists the states of all managed vehicles at once
+     *
+     * A snapshot is emitted (cObject details) once per step before the vehicles are updated individually.
+     * Vehicles are referred to by their handle, which can be resolved by the accompanying IdInterner.
+     */
+    class VehicleSnapshot : public omnetpp::cObject
+    {
+    public:
+        VehicleSnapshot(const IdInterner& ids, const std::vector<VehicleState>& vehicles) :
+            m_ids(ids), m_vehicles(vehicles) {}
+
+        const IdInterner& getIds() const { return m_ids; }
+        const std::vector<VehicleState>& getVehicles() const { return m_vehicles; }
+
+    private:
+        const IdInterner& m_ids;
+        const std::vector<VehicleState>& m_vehicles;
+    };
+
     class PersonObject : public omnetpp::cObject
     {
     public:
         virtual std::shared_ptr<PersonCache> getCache() const = 0;
+        virtual IdInterner::Handle getHandle() const = 0;
         virtual const TraCIPosition& getPosition() const = 0;
         virtual TraCIAngle getHeading() const = 0;
         virtual double getSpeed() const = 0;
@@ -86,6 +126,7 @@ protected:
     virtual VehicleSink* getVehicleSink(const std::string&);
     virtual void processPersons();
     virtual void processVehicles();
+    virtual void emitVehicleSnapshot();
 
     void traciInit() override;
     void traciStep() override;
@@ -100,6 +141,7 @@ private:
     std::map<std::string, omnetpp::cModule*> m_nodes;
     std::map<std::string, PersonSink*> m_persons;
     std::map<std::string, VehicleSink*> m_vehicles;
+    std::vector<VehicleState> m_vehicle_states;
     std::string m_vehicle_sink_module;
     std::string m_person_sink_module;
     bool m_destroy_vehicles_on_crash;
@@ -17,23 +17,40 @@ using namespace omnetpp;
 namespace traci
 {
 
+namespace
+{
+
+// vehicle dimensions do not change, thus they are not subscribed beyond a vehicle's departure (sorted)
+const std::vector<int> sDimensionVars { libsumo::VAR_LENGTH, libsumo::VAR_WIDTH, libsumo::VAR_HEIGHT };
+
+} // namespace
+
 Define_Module(BasicSubscriptionManager)
 
 BasicSubscriptionManager::BasicSubscriptionManager() : m_api(nullptr)
 {
 }
 
+BasicSubscriptionManager::~BasicSubscriptionManager()
+{
+    if (m_api) {
+        m_api->setSubscriptionTarget(nullptr);
+    }
+}
+
 void BasicSubscriptionManager::initialize()
 {
     Core* core = inet::getModuleFromPar<Core>(par("coreModule"), this);
     subscribeTraCI(core);
     m_api = core->getAPI();
+    m_api->setSubscriptionTarget(this);
     m_sim_cache = std::make_shared<SimulationCache>(m_api);
     m_ignore_persons = par("ignorePersons");
 }
 
 void BasicSubscriptionManager::finish()
 {
+    m_api->setSubscriptionTarget(nullptr);
     m_api = nullptr;
     unsubscribeTraCI();
     cSimpleModule::finish();
@@ -51,15 +68,9 @@ void BasicSubscriptionManager::traciInit()
     };
     subscribeSimulationVariables(vars);
 
-    // subscribe already running vehicles
-    for (const std::string& id : m_api->vehicle.getIDList()) {
-        subscribeVehicle(id);
-    }
-
-    // subscribe already running persons
-    for (const std::string& id : m_api->person.getIDList()) {
-        subscribePerson(id);
-    }
+    // subscribe already running vehicles and persons in bulk
+    subscribeVehicles(m_api->vehicle.getIDList());
+    subscribePersons(m_api->person.getIDList());
 
     // read SUMO start time and store it as offset
     m_offset = omnetpp::SimTime { m_api->simulation.getCurrentTime(), omnetpp::SIMTIME_MS };
@@ -74,12 +85,106 @@ void BasicSubscriptionManager::traciClose()
 {
 }
 
-void BasicSubscriptionManager::subscribePerson(const std::string& id)
+void BasicSubscriptionManager::prepareDecoding()
+{
+    m_sim_cache->invalidateStaged();
+    for (auto& vehicle : m_vehicle_handles) {
+        if (vehicle) {
+            vehicle->invalidateStaged();
+        }
+    }
+    if (!m_ignore_persons) {
+        for (auto& person : m_person_handles) {
+            if (person) {
+                person->invalidateStaged();
+            }
+        }
+    }
+}
+
+void BasicSubscriptionManager::commitDecoding()
 {
+    // objects without subscription response keep their values, e.g. arrived vehicles until their removal
+    // or objects subscribed after decoding which hold their initial values
+    m_sim_cache->commitStaged();
+    for (auto& vehicle : m_vehicle_handles) {
+        if (vehicle && vehicle->hasStaged()) {
+            vehicle->commitStaged();
+        }
+    }
+    if (!m_ignore_persons) {
+        for (auto& person : m_person_handles) {
+            if (person && person->hasStaged()) {
+                person->commitStaged();
+            }
+        }
+    }
+}
+
+SubscriptionDecoder::Results BasicSubscriptionManager::getVariableResults(int response, const std::string& id)
+{
+    if (response == libsumo::RESPONSE_SUBSCRIBE_VEHICLE_VARIABLE) {
+        const IdInterner::Handle handle = m_vehicle_ids.find(id);
+        if (handle != IdInterner::invalid) {
+            return m_vehicle_handles[handle]->getDecoderResults();
+        }
+    } else if (response == libsumo::RESPONSE_SUBSCRIBE_SIM_VARIABLE) {
+        return m_sim_cache->getDecoderResults();
+    } else if (response == libsumo::RESPONSE_SUBSCRIBE_PERSON_VARIABLE && !m_ignore_persons) {
+        const IdInterner::Handle handle = m_person_ids.find(id);
+        if (handle != IdInterner::invalid) {
+            return m_person_handles[handle]->getDecoderResults();
+        }
+    }
+
+    // fall back to API's subscription results
+    return SubscriptionDecoder::Results {};
+}
+
+SubscriptionDecoder::Results BasicSubscriptionManager::getContextResults(int, const std::string&, const std::string&)
+{
+    // context subscriptions are not managed by caches
+    return SubscriptionDecoder::Results {};
+}
+
+void BasicSubscriptionManager::releaseHandles()
+{
+    for (const std::string& id : m_released_persons) {
+        if (m_subscribed_persons.count(id) == 0) {
+            const IdInterner::Handle handle = m_person_ids.release(id);
+            if (handle != IdInterner::invalid) {
+                m_person_handles[handle].reset();
+            }
+            m_person_caches.erase(id);
+        }
+    }
+    m_released_persons.clear();
+
+    for (const std::string& id : m_released_vehicles) {
+        if (m_subscribed_vehicles.count(id) == 0) {
+            const IdInterner::Handle handle = m_vehicle_ids.release(id);
+            if (handle != IdInterner::invalid) {
+                m_vehicle_handles[handle].reset();
+                if (handle < m_reduced_vehicles.size()) {
+                    m_reduced_vehicles[handle] = false;
+                }
+            }
+            m_vehicle_caches.erase(id);
+        }
+    }
+    m_released_vehicles.clear();
+}
+
+void BasicSubscriptionManager::subscribePersons(const std::vector<std::string>& ids)
+{
+    // caches are looked up by decoder, thus they have to exist before subscription
+    for (const std::string& id : ids) {
+        m_subscribed_persons.insert(id);
+        getPersonCache(id);
+    }
     if (!m_person_vars.empty()) {
-        updatePersonSubscription(id, m_person_vars);
+        m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_PERSON_VARIABLE, ids, m_person_vars);
     }
-    m_subscribed_persons.insert(id);
 }
 
 void BasicSubscriptionManager::unsubscribePerson(const std::string& id, bool person_exists)
@@ -88,7 +193,8 @@ void BasicSubscriptionManager::unsubscribePerson(const std::string& id, bool per
         static const std::vector<int> empty;
         updatePersonSubscription(id, empty);
     }
-    m_subscribed_persons.insert(id);
+    m_subscribed_persons.erase(id);
+    m_released_persons.push_back(id);
 }
 
 void BasicSubscriptionManager::updatePersonSubscription(const std::string& id, const std::vector<int>& vars)
@@ -104,18 +210,30 @@ void BasicSubscriptionManager::subscribePersonVariables(const std::set<int>& add
     ASSERT(m_person_vars.size() >= tmp_vars.size());
 
     if (m_person_vars.size() != tmp_vars.size()) {
-        for (const std::string& vehicle : m_subscribed_persons) {
-            updatePersonSubscription(vehicle, m_person_vars);
-        }
+        const std::vector<std::string> persons(m_subscribed_persons.begin(), m_subscribed_persons.end());
+        m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_PERSON_VARIABLE, persons, m_person_vars);
     }
 }
 
-void BasicSubscriptionManager::subscribeVehicle(const std::string& id)
+void BasicSubscriptionManager::subscribeVehicles(const std::vector<std::string>& ids)
 {
-    if (!m_vehicle_vars.empty()) {
-        updateVehicleSubscription(id, m_vehicle_vars);
+    // caches are looked up by decoder, thus they have to exist before subscription
+    for (const std::string& id : ids) {
+        m_subscribed_vehicles.insert(id);
+        getVehicleCache(id);
+    }
+    if (ids.empty() || m_vehicle_vars.empty()) {
+        return;
+    }
+
+    // dimensions are taken from initial results of departure subscription, caches keep them afterwards
+    std::vector<int> departure_vars;
+    std::set_union(m_vehicle_vars.begin(), m_vehicle_vars.end(), sDimensionVars.begin(), sDimensionVars.end(),
+            std::back_inserter(departure_vars));
+    m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, ids, departure_vars);
+    if (departure_vars.size() != m_vehicle_vars.size()) {
+        m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, ids, m_vehicle_vars);
     }
-    m_subscribed_vehicles.insert(id);
 }
 
 void BasicSubscriptionManager::unsubscribeVehicle(const std::string& id, bool vehicle_exists)
@@ -125,6 +243,7 @@ void BasicSubscriptionManager::unsubscribeVehicle(const std::string& id, bool ve
         updateVehicleSubscription(id, empty);
     }
     m_subscribed_vehicles.erase(id);
+    m_released_vehicles.push_back(id);
 }
 
 void BasicSubscriptionManager::updateVehicleSubscription(const std::string& id, const std::vector<int>& vars)
@@ -140,12 +259,93 @@ void BasicSubscriptionManager::subscribeVehicleVariables(const std::set<int>& ad
     ASSERT(m_vehicle_vars.size() >= tmp_vars.size());
 
     if (m_vehicle_vars.size() != tmp_vars.size()) {
+        std::vector<std::string> vehicles;
+        for (const std::string& vehicle : m_subscribed_vehicles) {
+            if (!isVehicleSubscriptionReduced(m_vehicle_ids.find(vehicle))) {
+                vehicles.push_back(vehicle);
+            }
+        }
+        m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, vehicles, m_vehicle_vars);
+    }
+}
+
+void BasicSubscriptionManager::subscribeReducedVehicleVariables(const std::set<int>& add_vars)
+{
+    std::vector<int> tmp_vars;
+    std::set_union(m_reduced_vehicle_vars.begin(), m_reduced_vehicle_vars.end(), add_vars.begin(), add_vars.end(), std::back_inserter(tmp_vars));
+    std::swap(m_reduced_vehicle_vars, tmp_vars);
+    ASSERT(m_reduced_vehicle_vars.size() >= tmp_vars.size());
+
+    if (m_reduced_vehicle_vars.size() != tmp_vars.size()) {
+        std::vector<std::string> vehicles;
         for (const std::string& vehicle : m_subscribed_vehicles) {
-            updateVehicleSubscription(vehicle, m_vehicle_vars);
+            if (isVehicleSubscriptionReduced(m_vehicle_ids.find(vehicle))) {
+                vehicles.push_back(vehicle);
+            }
+        }
+        m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, vehicles, m_reduced_vehicle_vars);
+    }
+}
+
+void BasicSubscriptionManager::setVehicleSubscriptionReduced(const std::string& id, bool reduced)
+{
+    const IdInterner::Handle handle = m_vehicle_ids.find(id);
+    if (handle == IdInterner::invalid || m_subscribed_vehicles.count(id) == 0) {
+        return;
+    } else if (isVehicleSubscriptionReduced(handle) == reduced) {
+        return;
+    }
+
+    if (m_reduced_vehicles.size() <= handle) {
+        m_reduced_vehicles.resize(handle + 1, false);
+    }
+    m_reduced_vehicles[handle] = reduced;
+
+    // subscription is reissued by next commit
+    if (!isVehicleSubscriptionSwitched(handle)) {
+        if (m_switched_vehicles.size() <= handle) {
+            m_switched_vehicles.resize(handle + 1, false);
         }
+        m_switched_vehicles[handle] = true;
+        m_switched_vehicle_ids.push_back(id);
     }
 }
 
+void BasicSubscriptionManager::commitVehicleSubscriptions()
+{
+    std::vector<std::string> reduced;
+    std::vector<std::string> complete;
+    for (std::string& id : m_switched_vehicle_ids) {
+        // vehicles might have arrived since their switch
+        if (m_subscribed_vehicles.count(id) == 0) {
+            continue;
+        }
+
+        const IdInterner::Handle handle = m_vehicle_ids.find(id);
+        if (isVehicleSubscriptionReduced(handle)) {
+            reduced.push_back(std::move(id));
+        } else {
+            complete.push_back(std::move(id));
+        }
+    }
+    m_switched_vehicle_ids.clear();
+    std::fill(m_switched_vehicles.begin(), m_switched_vehicles.end(), false);
+
+    // caches are filled by initial results of the reissued subscriptions
+    m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, reduced, m_reduced_vehicle_vars);
+    m_api->subscribeObjects(libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE, complete, m_vehicle_vars);
+}
+
+bool BasicSubscriptionManager::isVehicleSubscriptionReduced(IdInterner::Handle handle) const
+{
+    return handle < m_reduced_vehicles.size() && m_reduced_vehicles[handle];
+}
+
+bool BasicSubscriptionManager::isVehicleSubscriptionSwitched(IdInterner::Handle handle) const
+{
+    return handle < m_switched_vehicles.size() && m_switched_vehicles[handle];
+}
+
 void BasicSubscriptionManager::subscribeSimulationVariables(const std::set<int>& add_vars)
 {
     std::vector<int> tmp_vars;
@@ -160,25 +360,18 @@ void BasicSubscriptionManager::subscribeSimulationVariables(const std::set<int>&
 
 void BasicSubscriptionManager::step()
 {
-    const auto& simvars = m_api->simulation.getSubscriptionResults("");
-    m_sim_cache->reset(simvars);
+    // subscription results of this step have been decoded into caches already
     ASSERT(checkTimeSync(*m_sim_cache, omnetpp::simTime() + m_offset));
+    releaseHandles();
 
     const auto& arrivedVehicles = m_sim_cache->get<libsumo::VAR_ARRIVED_VEHICLES_IDS>();
     for (const auto& id : arrivedVehicles) {
         unsubscribeVehicle(id, false);
     }
+    commitVehicleSubscriptions();
 
-    const auto& departedVehicles = m_sim_cache->get<libsumo::VAR_DEPARTED_VEHICLES_IDS>();
-    for (const auto& id : departedVehicles) {
-        subscribeVehicle(id);
-    }
-
-    const auto& vehicles = m_api->vehicle;
-    for (const std::string& vehicle : m_subscribed_vehicles) {
-        const auto& vars = vehicles.getSubscriptionResults(vehicle);
-        getVehicleCache(vehicle)->reset(vars);
-    }
+    // initial results of new subscriptions are decoded into caches
+    subscribeVehicles(m_sim_cache->get<libsumo::VAR_DEPARTED_VEHICLES_IDS>());
 
     if (!m_ignore_persons) {
         const auto& arrivedPersons = m_sim_cache->get<libsumo::VAR_ARRIVED_PERSONS_IDS>();
@@ -186,16 +379,7 @@ void BasicSubscriptionManager::step()
             unsubscribePerson(id, false);
         }
 
-        const auto& departedPersons = m_sim_cache->get<libsumo::VAR_DEPARTED_PERSONS_IDS>();
-        for (const auto& id : departedPersons) {
-            subscribePerson(id);
-        }
-
-        const auto& persons = m_api->person;
-        for (const std::string& person : m_subscribed_persons) {
-            const auto& vars = persons.getSubscriptionResults(person);
-            getPersonCache(person)->reset(vars);
-        }
+        subscribePersons(m_sim_cache->get<libsumo::VAR_DEPARTED_PERSONS_IDS>());
     }
 }
 
@@ -203,7 +387,15 @@ std::shared_ptr<PersonCache> BasicSubscriptionManager::getPersonCache(const std:
 {
     auto found = m_person_caches.find(id);
     if (found == m_person_caches.end()) {
-        std::tie(found, std::ignore) = m_person_caches.emplace(id, std::make_shared<PersonCache>(m_api, id));
+        // lookup tables must not change while a pipelined step is decoded
+        m_api->awaitSimulationStep();
+        const IdInterner::Handle handle = m_person_ids.intern(id);
+        auto cache = std::make_shared<PersonCache>(m_api, id, handle);
+        if (m_person_handles.size() <= handle) {
+            m_person_handles.resize(handle + 1);
+        }
+        m_person_handles[handle] = cache;
+        std::tie(found, std::ignore) = m_person_caches.emplace(id, std::move(cache));
     }
     return found->second;
 }
@@ -212,7 +404,15 @@ std::shared_ptr<VehicleCache> BasicSubscriptionManager::getVehicleCache(const st
 {
     auto found = m_vehicle_caches.find(id);
     if (found == m_vehicle_caches.end()) {
-        std::tie(found, std::ignore) = m_vehicle_caches.emplace(id, std::make_shared<VehicleCache>(m_api, id));
+        // lookup tables must not change while a pipelined step is decoded
+        m_api->awaitSimulationStep();
+        const IdInterner::Handle handle = m_vehicle_ids.intern(id);
+        auto cache = std::make_shared<VehicleCache>(m_api, id, handle);
+        if (m_vehicle_handles.size() <= handle) {
+            m_vehicle_handles.resize(handle + 1);
+        }
+        m_vehicle_handles[handle] = cache;
+        std::tie(found, std::ignore) = m_vehicle_caches.emplace(id, std::move(cache));
     }
     return found->second;
 }
@@ -223,6 +423,16 @@ std::shared_ptr<SimulationCache> BasicSubscriptionManager::getSimulationCache()
     return m_sim_cache;
 }
 
+const IdInterner& BasicSubscriptionManager::getPersonIds() const
+{
+    return m_person_ids;
+}
+
+const IdInterner& BasicSubscriptionManager::getVehicleIds() const
+{
+    return m_vehicle_ids;
+}
+
 const std::unordered_set<std::string>& BasicSubscriptionManager::getSubscribedPersons() const
 {
     return m_subscribed_persons;
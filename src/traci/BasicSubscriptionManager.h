@@ -8,33 +8,42 @@
 #define BASICSUBSCRIPTIONMANAGER_H_BCDX4IU2
 
 #include "traci/Listener.h"
+#include "traci/SubscriptionDecoder.h"
 #include "traci/SubscriptionManager.h"
 #include <omnetpp/csimplemodule.h>
 #include <omnetpp/simtime.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace traci
 {
 
 class API;
 
-class BasicSubscriptionManager : public Listener, public SubscriptionManager, public omnetpp::cSimpleModule
+class BasicSubscriptionManager : public Listener, public SubscriptionManager, public omnetpp::cSimpleModule,
+    private SubscriptionDecoder::Target
 {
 public:
     BasicSubscriptionManager();
+    ~BasicSubscriptionManager();
 
     // implement traci::SubscriptionManager
     void step() override;
     void subscribePersonVariables(const std::set<int>& personVariables) override;
     void subscribeVehicleVariables(const std::set<int>& vehicleVariables) override;
     void subscribeSimulationVariables(const std::set<int>& simulationVariables) override;
+    void subscribeReducedVehicleVariables(const std::set<int>& vehicleVariables) override;
+    void setVehicleSubscriptionReduced(const std::string& id, bool reduced) override;
+    void commitVehicleSubscriptions() override;
     const std::unordered_set<std::string>& getSubscribedPersons() const override;
     const std::unordered_set<std::string>& getSubscribedVehicles() const override;
     const std::unordered_map<std::string, std::shared_ptr<VehicleCache>>& getAllVehicleCaches() const override;
     std::shared_ptr<PersonCache> getPersonCache(const std::string& id) override;
     std::shared_ptr<VehicleCache> getVehicleCache(const std::string& id) override;
     std::shared_ptr<SimulationCache> getSimulationCache() override;
+    const IdInterner& getPersonIds() const override;
+    const IdInterner& getVehicleIds() const override;
 
 protected:
     void initialize() override;
@@ -48,22 +57,46 @@ private:
     void traciStep() override;
     void traciClose() override;
 
-    void subscribePerson(const std::string& id);
+    // implement traci::SubscriptionDecoder::Target (subscription results are decoded into caches)
+    void prepareDecoding() override;
+    void commitDecoding() override;
+    SubscriptionDecoder::Results getVariableResults(int response, const std::string& id) override;
+    SubscriptionDecoder::Results getContextResults(int response, const std::string& context, const std::string& id) override;
+
+    void releaseHandles();
+
+    void subscribePersons(const std::vector<std::string>& ids);
     void unsubscribePerson(const std::string& id, bool person_exists);
     void updatePersonSubscription(const std::string& id, const std::vector<int>& vars);
 
-    void subscribeVehicle(const std::string& id);
+    void subscribeVehicles(const std::vector<std::string>& ids);
     void unsubscribeVehicle(const std::string& id, bool vehicle_exists);
     void updateVehicleSubscription(const std::string& id, const std::vector<int>& vars);
+    bool isVehicleSubscriptionReduced(IdInterner::Handle) const;
+    bool isVehicleSubscriptionSwitched(IdInterner::Handle) const;
 
     std::shared_ptr<API> m_api;
     std::unordered_set<std::string> m_subscribed_persons;
     std::unordered_set<std::string> m_subscribed_vehicles;
     std::vector<int> m_person_vars;
     std::vector<int> m_vehicle_vars;
+    std::vector<int> m_reduced_vehicle_vars;
     std::vector<int> m_sim_vars;
     std::unordered_map<std::string, std::shared_ptr<PersonCache>> m_person_caches;
     std::unordered_map<std::string, std::shared_ptr<VehicleCache>> m_vehicle_caches;
+    IdInterner m_person_ids;
+    IdInterner m_vehicle_ids;
+    // caches indexed by handle
+    std::vector<std::shared_ptr<PersonCache>> m_person_handles;
+    std::vector<std::shared_ptr<VehicleCache>> m_vehicle_handles;
+    // vehicles with reduced subscription indexed by handle
+    std::vector<bool> m_reduced_vehicles;
+    // vehicles with pending subscription switch, both by handle and by ID
+    std::vector<bool> m_switched_vehicles;
+    std::vector<std::string> m_switched_vehicle_ids;
+    // handles of arrived objects are released at next step
+    std::vector<std::string> m_released_persons;
+    std::vector<std::string> m_released_vehicles;
     std::shared_ptr<SimulationCache> m_sim_cache;
     omnetpp::SimTime m_offset = omnetpp::SimTime::ZERO;
     bool m_ignore_persons;
@@ -3,6 +3,8 @@
 #include "traci/API.h"
 #include "traci/SubscriptionManager.h"
 #include <inet/common/ModuleAccess.h>
+#include <algorithm>
+#include <iomanip>
 #include <limits>
 
 Define_Module(traci::Core)
@@ -15,6 +17,22 @@ namespace
 const simsignal_t initSignal = cComponent::registerSignal("traci.init");
 const simsignal_t stepSignal = cComponent::registerSignal("traci.step");
 const simsignal_t closeSignal = cComponent::registerSignal("traci.close");
+
+// wall-clock durations of a simulation step's phases in seconds
+const simsignal_t sendTimeSignal = cComponent::registerSignal("traciSendTime");
+const simsignal_t waitTimeSignal = cComponent::registerSignal("traciWaitTime");
+const simsignal_t resetTimeSignal = cComponent::registerSignal("traciResetTime");
+const simsignal_t decodeTimeSignal = cComponent::registerSignal("traciDecodeTime");
+const simsignal_t subscriptionTimeSignal = cComponent::registerSignal("traciSubscriptionTime");
+const simsignal_t dispatchTimeSignal = cComponent::registerSignal("traciDispatchTime");
+const simsignal_t nodeUpdateTimeSignal = cComponent::registerSignal("traciNodeUpdateTime");
+
+const char* stepPhaseNames[] = { "send", "wait", "reset", "decode", "subscriptions", "node update", "dispatch" };
+
+inline double seconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
 }
 
 namespace traci
@@ -38,37 +56,88 @@ void Core::initialize()
     cModule* manager = getParentModule();
     m_launcher = inet::getModuleFromPar<Launcher>(par("launcherModule"), manager);
     m_stopping = par("selfStopping");
+    m_pipelined = par("pipelined");
     scheduleAt(par("startTime"), m_connectEvent);
     m_subscriptions = inet::getModuleFromPar<SubscriptionManager>(par("subscriptionsModule"), manager, false);
+    manager->subscribe(nodeUpdateTimeSignal, this);
 }
 
 void Core::finish()
 {
     emit(closeSignal, simTime());
     if (!m_connectEvent->isScheduled()) {
+        if (m_pipelined) {
+            const unsigned long interrupted = m_traci->getInterruptedSimulationSteps();
+            if (interrupted > 0) {
+                EV_WARN << interrupted << " pipelined TraCI steps have been interrupted by other requests, "
+                    << "results may deviate from blocking mode" << endl;
+            }
+            recordScalar("interruptedSimulationSteps", interrupted);
+        }
+        if (m_startupTime != std::chrono::steady_clock::duration::zero()) {
+            recordScalar("startupTime", seconds(m_startupTime), "s");
+        }
+        if (m_steps > 0) {
+            auto total = std::chrono::steady_clock::duration::zero();
+            for (auto duration : m_stepTimes) {
+                total += duration;
+            }
+            EV_INFO << "TraCI step timing summary of " << m_steps << " steps:" << endl;
+            for (unsigned phase = 0; phase < NumStepPhases; ++phase) {
+                const double time = seconds(m_stepTimes[phase]);
+                EV_INFO << std::setw(14) << stepPhaseNames[phase] << ": " << time << " s total, "
+                    << 1000.0 * time / m_steps << " ms per step, "
+                    << (total.count() > 0 ? 100.0 * m_stepTimes[phase].count() / total.count() : 0.0) << " %" << endl;
+            }
+        }
         m_traci->close();
     }
 }
 
+void Core::receiveSignal(cComponent*, simsignal_t signal, double value, cObject*)
+{
+    if (signal == nodeUpdateTimeSignal) {
+        m_nodeUpdateTime += std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(value));
+    }
+}
+
 void Core::handleMessage(cMessage* msg)
 {
     if (msg == m_updateEvent) {
-        m_traci->simulationStep();
+        if (m_pipelined) {
+            m_traci->completeSimulationStep();
+        } else {
+            m_traci->simulationStep();
+        }
+        const auto decoded = std::chrono::steady_clock::now();
         if (m_subscriptions) {
             m_subscriptions->step();
         }
+        const auto subscribed = std::chrono::steady_clock::now();
+        m_nodeUpdateTime = std::chrono::steady_clock::duration::zero();
         emit(stepSignal, simTime());
+        const auto dispatched = std::chrono::steady_clock::now();
+        recordStepTiming(subscribed - decoded, dispatched - subscribed);
+
+        if (m_startupTime == std::chrono::steady_clock::duration::zero()) {
+            m_startupTime = std::chrono::steady_clock::now() - m_connectTime;
+        }
 
         if (!m_stopping || m_traci->simulation.getMinExpectedNumber() > 0) {
-            scheduleAt(simTime() + m_updateInterval, m_updateEvent);
+            scheduleUpdate();
         }
     } else if (msg == m_connectEvent) {
+        m_connectTime = std::chrono::steady_clock::now();
         m_traci->connect(m_launcher->launch());
+        const std::string trace = par("traceFile").stringValue();
+        if (!trace.empty()) {
+            m_traci->recordTrace(trace);
+        }
         checkVersion();
         syncTime();
         emit(initSignal, simTime());
         m_updateInterval = Time { m_traci->simulation.getDeltaT() };
-        scheduleAt(simTime() + m_updateInterval, m_updateEvent);
+        scheduleUpdate();
     }
 }
 
@@ -103,6 +172,37 @@ void Core::syncTime()
     }
 }
 
+void Core::scheduleUpdate()
+{
+    scheduleAt(simTime() + m_updateInterval, m_updateEvent);
+    if (m_pipelined) {
+        // SUMO computes the next step while OMNeT++ processes events until the update event
+        m_traci->requestSimulationStep();
+    }
+}
+
+void Core::recordStepTiming(std::chrono::steady_clock::duration subscriptions, std::chrono::steady_clock::duration dispatch)
+{
+    const API::StepTiming& timing = m_traci->getStepTiming();
+    m_stepTimes[Send] += timing.send;
+    m_stepTimes[Wait] += timing.wait;
+    m_stepTimes[Reset] += timing.reset;
+    m_stepTimes[Decode] += timing.decode;
+    // node updates are part of dispatch, other listeners take the remainder
+    const auto nodeUpdate = std::min(m_nodeUpdateTime, dispatch);
+    m_stepTimes[Subscriptions] += subscriptions;
+    m_stepTimes[NodeUpdate] += nodeUpdate;
+    m_stepTimes[Dispatch] += dispatch - nodeUpdate;
+    ++m_steps;
+
+    emit(sendTimeSignal, seconds(timing.send));
+    emit(waitTimeSignal, seconds(timing.wait));
+    emit(resetTimeSignal, seconds(timing.reset));
+    emit(decodeTimeSignal, seconds(timing.decode));
+    emit(subscriptionTimeSignal, seconds(subscriptions));
+    emit(dispatchTimeSignal, seconds(dispatch - nodeUpdate));
+}
+
 std::shared_ptr<API> Core::getAPI()
 {
     return m_traci;
@@ -1,9 +1,12 @@
 #ifndef CORE_H_HPQGM1MF
 #define CORE_H_HPQGM1MF
 
+#include <omnetpp/clistener.h>
 #include <omnetpp/cmessage.h>
 #include <omnetpp/csimplemodule.h>
 #include <omnetpp/simtime.h>
+#include <array>
+#include <chrono>
 #include <memory>
 
 namespace traci
@@ -14,7 +17,7 @@ class Launcher;
 class LiteAPI;
 class SubscriptionManager;
 
-class Core : public omnetpp::cSimpleModule
+class Core : public omnetpp::cSimpleModule, public omnetpp::cListener
 {
 public:
     Core();
@@ -23,11 +26,14 @@ public:
     void initialize() override;
     void finish() override;
     void handleMessage(omnetpp::cMessage*) override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, double, omnetpp::cObject*) override;
     std::shared_ptr<API> getAPI();
 
 protected:
     virtual void checkVersion();
     virtual void syncTime();
+    void scheduleUpdate();
+    void recordStepTiming(std::chrono::steady_clock::duration subscriptions, std::chrono::steady_clock::duration dispatch);
 
 private:
     omnetpp::cMessage* m_connectEvent;
@@ -37,7 +43,19 @@ private:
     Launcher* m_launcher;
     std::shared_ptr<API> m_traci;
     bool m_stopping;
+    bool m_pipelined;
     SubscriptionManager* m_subscriptions;
+
+    // wall-clock time from connection attempt until completion of first simulation step
+    std::chrono::steady_clock::time_point m_connectTime;
+    std::chrono::steady_clock::duration m_startupTime = std::chrono::steady_clock::duration::zero();
+
+    // accumulated wall-clock time of simulation step phases, summarized at finish
+    enum StepPhase { Send, Wait, Reset, Decode, Subscriptions, NodeUpdate, Dispatch, NumStepPhases };
+    std::array<std::chrono::steady_clock::duration, NumStepPhases> m_stepTimes {};
+    unsigned long m_steps = 0;
+    // node managers report their update time while traci.step is dispatched
+    std::chrono::steady_clock::duration m_nodeUpdateTime = std::chrono::steady_clock::duration::zero();
 };
 
 } // namespace traci
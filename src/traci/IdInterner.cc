@@ -0,0 +1,73 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/IdInterner.h"
+#include <stdexcept>
+
+namespace traci
+{
+
+constexpr IdInterner::Handle IdInterner::invalid;
+
+IdInterner::Handle IdInterner::intern(const std::string& id)
+{
+    auto inserted = m_handles.emplace(id, invalid);
+    if (inserted.second) {
+        Handle handle = invalid;
+        if (m_free.empty()) {
+            handle = static_cast<Handle>(m_names.size());
+            m_names.push_back(nullptr);
+        } else {
+            handle = m_free.back();
+            m_free.pop_back();
+        }
+        m_names[handle] = &inserted.first->first;
+        inserted.first->second = handle;
+    }
+    return inserted.first->second;
+}
+
+IdInterner::Handle IdInterner::release(const std::string& id)
+{
+    auto found = m_handles.find(id);
+    if (found == m_handles.end()) {
+        return invalid;
+    }
+
+    const Handle handle = found->second;
+    m_names[handle] = nullptr;
+    m_free.push_back(handle);
+    m_handles.erase(found);
+    return handle;
+}
+
+IdInterner::Handle IdInterner::find(const std::string& id) const
+{
+    auto found = m_handles.find(id);
+    return found != m_handles.end() ? found->second : invalid;
+}
+
+bool IdInterner::contains(Handle handle) const
+{
+    return handle < m_names.size() && m_names[handle] != nullptr;
+}
+
+const std::string& IdInterner::name(Handle handle) const
+{
+    if (!contains(handle)) {
+        throw std::out_of_range("no identifier assigned to handle " + std::to_string(handle));
+    }
+    return *m_names[handle];
+}
+
+void IdInterner::clear()
+{
+    m_handles.clear();
+    m_names.clear();
+    m_free.clear();
+}
+
+} // namespace traci
@@ -0,0 +1,89 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef IDINTERNER_H_W7QZ3NPA
+#define IDINTERNER_H_W7QZ3NPA
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * IdInterner maps SUMO object identifiers to dense integer handles.
+ *
+ * Handles are in the range [0, capacity()) and released handles are reused,
+ * i.e. per-object state can be kept in vectors indexed by handle instead of
+ * maps keyed by identifier strings.
+ */
+class IdInterner
+{
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle invalid = std::numeric_limits<Handle>::max();
+
+    /**
+     * Get handle of identifier, a new handle is assigned if identifier is unknown
+     * \param id object identifier
+     * \return handle of identifier
+     */
+    Handle intern(const std::string& id);
+
+    /**
+     * Release handle of identifier for reuse by other identifiers
+     * \param id object identifier
+     * \return released handle or invalid if identifier is unknown
+     */
+    Handle release(const std::string& id);
+
+    /**
+     * Look up handle of identifier
+     * \param id object identifier
+     * \return handle or invalid if identifier is unknown
+     */
+    Handle find(const std::string& id) const;
+
+    /**
+     * Check if handle is currently assigned to an identifier
+     */
+    bool contains(Handle handle) const;
+
+    /**
+     * Get identifier of an assigned handle
+     * \param handle valid handle
+     * \return object identifier
+     */
+    const std::string& name(Handle handle) const;
+
+    /**
+     * Number of currently assigned handles
+     */
+    std::size_t size() const { return m_handles.size(); }
+
+    /**
+     * Upper bound of handles, suitable for sizing vectors indexed by handle
+     */
+    std::size_t capacity() const { return m_names.size(); }
+
+    /**
+     * Release all handles
+     */
+    void clear();
+
+private:
+    std::unordered_map<std::string, Handle> m_handles;
+    // pointers to map keys (stable until erasure), nullptr for free handles
+    std::vector<const std::string*> m_names;
+    std::vector<Handle> m_free;
+};
+
+} // namespace traci
+
+#endif /* IDINTERNER_H_W7QZ3NPA */
@@ -0,0 +1,52 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef INPROCESSBACKEND_H_R3MZ8QTD
+#define INPROCESSBACKEND_H_R3MZ8QTD
+
+#include "traci/sumo/utils/traci/TraCIAPI.h"
+#include "traci/SubscriptionDecoder.h"
+#include <string>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * InProcessBackend serves traci::API without any TraCI connection, e.g. by a SUMO instance within this process.
+ *
+ * Besides TraCIAPI's scope requests, it stores subscription results directly by a SubscriptionDecoder::Target
+ * like traci::API's decoding of TraCI responses does.
+ */
+class InProcessBackend : public TraCIAPI::Backend
+{
+public:
+    /**
+     * Subscribe variables of many objects, see API::subscribeObjects
+     *
+     * Initial values are stored in the current cache slots.
+     * \param command variable subscription command of a domain, e.g. CMD_SUBSCRIBE_VEHICLE_VARIABLE
+     * \param ids identifiers of subscribed objects
+     * \param vars subscribed variables, empty list cancels subscriptions
+     * \param target storage of initial values
+     */
+    virtual void subscribeObjects(int command, const std::vector<std::string>& ids, const std::vector<int>& vars,
+            SubscriptionDecoder::Target& target) = 0;
+
+    /**
+     * Store subscription results of the latest simulation step
+     *
+     * Values are stored in the staging buffers of cache slots like SubscriptionDecoder::decodeStep does.
+     * \param target storage of results
+     */
+    virtual void readSubscriptions(SubscriptionDecoder::Target& target) = 0;
+
+    using TraCIAPI::Backend::readSubscriptions;
+};
+
+} // namespace traci
+
+#endif /* INPROCESSBACKEND_H_R3MZ8QTD */
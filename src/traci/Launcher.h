@@ -1,17 +1,29 @@
 #ifndef LAUNCHER_H_NAC0X8JG
 #define LAUNCHER_H_NAC0X8JG
 
+#include <functional>
+#include <memory>
 #include <string>
 
+namespace tcpip { class Socket; }
+
 namespace traci
 {
 
+class InProcessBackend;
+
 struct ServerEndpoint
 {
     std::string hostname;
     int port;
     int clientId = 1;
     bool retry = false;
+
+    // in-process servers provide their own connection instead of a TCP socket
+    std::function<std::unique_ptr<tcpip::Socket>()> connection;
+
+    // in-process simulations may serve requests without any TraCI connection
+    std::function<std::unique_ptr<InProcessBackend>()> backend;
 };
 
 class Launcher
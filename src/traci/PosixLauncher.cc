@@ -66,6 +66,7 @@ void PosixLauncher::initialize()
     m_command = par("command").stringValue();
     m_sumocfg = par("sumocfg").stringValue();
     m_extra_options = par("extraOptions").stringValue();
+    m_load_state = par("loadState").stringValue();
     m_port = par("port");
     m_seed = par("seed");
 }
@@ -151,6 +152,10 @@ std::string PosixLauncher::command()
       command.append(1, ' ').append(m_extra_options);
     }
 
+    if (!m_load_state.empty()) {
+      command.append(" --load-state ").append(m_load_state);
+    }
+
     return command;
 }
 
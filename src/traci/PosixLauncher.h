@@ -29,6 +29,7 @@ private:
     std::string m_command;
     std::string m_sumocfg;
     std::string m_extra_options;
+    std::string m_load_state;
     int m_port;
     int m_seed;
     pid_t m_pid;
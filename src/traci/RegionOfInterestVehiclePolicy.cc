@@ -4,6 +4,7 @@
 #include "traci/VariableCache.h"
 #include "traci/VehicleLifecycle.h"
 #include <omnetpp/cxmlelement.h>
+#include <algorithm>
 #include <cassert>
 
 using namespace omnetpp;
@@ -30,7 +31,17 @@ void RegionOfInterestVehiclePolicy::initialize(VehicleLifecycle* lifecycle)
 
     m_lifecycle = lifecycle;
     m_subscriptions = manager->getSubscriptions();
+
+    /* vehicles far off regions are monitored by their position only */
+    m_reduce_subscriptions = par("reduceSubscriptions") && !m_regions.empty();
+    m_subscription_margin = par("subscriptionMargin");
+    if (m_reduce_subscriptions) {
+        m_subscriptions->subscribeReducedVehicleVariables({ libsumo::VAR_POSITION });
+    }
     manager->subscribe(BasicNodeManager::updateNodeSignal, this);
+    if (!m_regions.empty()) {
+        manager->subscribe(BasicNodeManager::updateVehiclesSignal, this);
+    }
 }
 
 void RegionOfInterestVehiclePolicy::receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t signal, unsigned long n, omnetpp::cObject*)
@@ -40,6 +51,33 @@ void RegionOfInterestVehiclePolicy::receiveSignal(omnetpp::cComponent*, omnetpp:
     }
 }
 
+void RegionOfInterestVehiclePolicy::receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t signal, omnetpp::cObject* obj, omnetpp::cObject*)
+{
+    if (signal == BasicNodeManager::updateVehiclesSignal) {
+        auto snapshot = check_and_cast<BasicNodeManager::VehicleSnapshot*>(obj);
+        classifyVehicles(snapshot->getVehicles());
+    }
+}
+
+void RegionOfInterestVehiclePolicy::classifyVehicles(const std::vector<BasicNodeManager::VehicleState>& vehicles)
+{
+    /* test positions of all managed vehicles in one pass, updateVehicle looks up the outcome */
+    m_snapshot_positions.clear();
+    for (const BasicNodeManager::VehicleState& vehicle : vehicles) {
+        m_snapshot_positions.push_back(vehicle.position);
+    }
+    const std::vector<bool> covered = m_regions.cover(m_snapshot_positions);
+
+    m_coverage.assign(m_subscriptions->getVehicleIds().capacity(), Coverage::Unknown);
+    for (std::size_t i = 0; i < vehicles.size(); ++i) {
+        const IdInterner::Handle handle = vehicles[i].handle;
+        if (handle >= m_coverage.size()) {
+            m_coverage.resize(handle + 1, Coverage::Unknown);
+        }
+        m_coverage[handle] = covered[i] ? Coverage::Inside : Coverage::Outside;
+    }
+}
+
 VehiclePolicy::Decision RegionOfInterestVehiclePolicy::addVehicle(const std::string& id)
 {
     assert(m_subscriptions);
@@ -55,7 +93,7 @@ VehiclePolicy::Decision RegionOfInterestVehiclePolicy::addVehicle(const std::str
             return Decision::Continue;
         } else {
             EV_DEBUG << "Vehicle " << id << " is not added: departed outside region of interest" << endl;
-            m_outside.insert(id);
+            setOutside(vehicle);
             return Decision::Discard;
         }
     }
@@ -68,30 +106,36 @@ VehiclePolicy::Decision RegionOfInterestVehiclePolicy::updateVehicle(const std::
 
     if (m_regions.empty()) {
         return Decision::Continue;
-    } else {
-        /* check if vehicle is in Region of Interest */
+    }
+
+    /* check if vehicle is in Region of Interest, preferably by outcome of snapshot classification */
+    const IdInterner::Handle handle = m_subscriptions->getVehicleIds().find(id);
+    Coverage coverage = handle < m_coverage.size() ? m_coverage[handle] : Coverage::Unknown;
+    if (coverage == Coverage::Unknown) {
         auto vehicle = m_subscriptions->getVehicleCache(id);
-        if (m_regions.cover(vehicle->get<libsumo::VAR_POSITION>())) {
-            /* vehicle is known and in RoI */
-            return Decision::Continue;
-        } else {
-            /* known vehicle left Region of Interest */
-            EV_DEBUG << "Vehicle " << id << " was removed: left region of interest" << endl;
-            m_lifecycle->removeVehicle(id);
-            m_outside.insert(id);
-            return Decision::Discard;
-        }
+        coverage = m_regions.cover(vehicle->get<libsumo::VAR_POSITION>()) ? Coverage::Inside : Coverage::Outside;
+    }
+
+    if (coverage == Coverage::Inside) {
+        /* vehicle is known and in RoI */
+        return Decision::Continue;
+    } else {
+        /* known vehicle left Region of Interest */
+        EV_DEBUG << "Vehicle " << id << " was removed: left region of interest" << endl;
+        m_lifecycle->removeVehicle(id);
+        setOutside(m_subscriptions->getVehicleCache(id));
+        return Decision::Discard;
     }
 }
 
 VehiclePolicy::Decision RegionOfInterestVehiclePolicy::removeVehicle(const std::string& id)
 {
-    auto found = m_outside.find(id);
-    if (found == m_outside.end()) {
-        return Decision::Continue;
-    } else {
-        m_outside.erase(found);
+    const IdInterner::Handle handle = m_subscriptions->getVehicleIds().find(id);
+    if (handle < m_outside.size() && m_outside[handle]) {
+        m_outside[handle].reset();
         return Decision::Discard;
+    } else {
+        return Decision::Continue;
     }
 }
 
@@ -100,16 +144,60 @@ void RegionOfInterestVehiclePolicy::checkRegionOfInterest()
     assert(m_subscriptions);
     assert(m_lifecycle);
 
-    for (auto it = m_outside.begin(); it != m_outside.end();) {
-        auto vehicle = m_subscriptions->getVehicleCache(*it);
-        if (m_regions.cover(vehicle->get<libsumo::VAR_POSITION>())) {
-            EV_DEBUG << "Vehicle " << *it << " is added: entered region of interest" << endl;
-            m_lifecycle->addVehicle(*it);
-            it = m_outside.erase(it);
+    /* snapshot classification is valid for the ongoing step only */
+    std::fill(m_coverage.begin(), m_coverage.end(), Coverage::Unknown);
+
+    /* test positions of all outside vehicles in one pass */
+    m_outside_handles.clear();
+    m_outside_positions.clear();
+    for (std::size_t handle = 0; handle < m_outside.size(); ++handle) {
+        if (m_outside[handle]) {
+            m_outside_handles.push_back(handle);
+            m_outside_positions.push_back(m_outside[handle]->get<libsumo::VAR_POSITION>());
+        }
+    }
+    const std::vector<bool> covered = m_regions.cover(m_outside_positions);
+
+    /* subscriptions of all vehicles switched during this step are reissued in one batch */
+    std::vector<std::shared_ptr<VehicleCache>> entered;
+    for (std::size_t i = 0; i < m_outside_handles.size(); ++i) {
+        auto& vehicle = m_outside[m_outside_handles[i]];
+        if (covered[i]) {
+            if (m_reduce_subscriptions) {
+                m_subscriptions->setVehicleSubscriptionReduced(vehicle->getVehicleId(), false);
+            }
+            entered.push_back(std::move(vehicle));
         } else {
-            ++it;
+            updateSubscription(*vehicle);
         }
     }
+    m_subscriptions->commitVehicleSubscriptions();
+
+    /* entered vehicles are initialized from their complete subscription */
+    for (auto& vehicle : entered) {
+        EV_DEBUG << "Vehicle " << vehicle->getVehicleId() << " is added: entered region of interest" << endl;
+        m_lifecycle->addVehicle(vehicle->getVehicleId());
+    }
+}
+
+void RegionOfInterestVehiclePolicy::setOutside(std::shared_ptr<VehicleCache> vehicle)
+{
+    const IdInterner::Handle handle = vehicle->getHandle();
+    ASSERT(handle != IdInterner::invalid);
+    if (m_outside.size() <= handle) {
+        m_outside.resize(handle + 1);
+    }
+    updateSubscription(*vehicle);
+    m_outside[handle] = std::move(vehicle);
+}
+
+void RegionOfInterestVehiclePolicy::updateSubscription(VehicleCache& vehicle)
+{
+    if (m_reduce_subscriptions) {
+        const TraCIPosition& position = vehicle.get<libsumo::VAR_POSITION>();
+        const bool near = m_regions.near(position, m_subscription_margin);
+        m_subscriptions->setVehicleSubscriptionReduced(vehicle.getVehicleId(), !near);
+    }
 }
 
 } // namespace traci
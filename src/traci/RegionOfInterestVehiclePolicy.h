@@ -1,15 +1,18 @@
 #ifndef REGIONOFINTERESTVEHICLEPOLICY_H_TNK4CWW6
 #define REGIONOFINTERESTVEHICLEPOLICY_H_TNK4CWW6
 
+#include "traci/BasicNodeManager.h"
 #include "traci/RegionsOfInterest.h"
 #include "traci/VehiclePolicy.h"
-#include <unordered_set>
 #include <omnetpp/clistener.h>
+#include <memory>
+#include <vector>
 
 namespace traci
 {
 
 class SubscriptionManager;
+class VehicleCache;
 
 class RegionOfInterestVehiclePolicy : public VehiclePolicy, public omnetpp::cListener
 {
@@ -21,14 +24,29 @@ public:
 
 protected:
     void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, unsigned long n, omnetpp::cObject*) override;
+    void receiveSignal(omnetpp::cComponent*, omnetpp::simsignal_t, omnetpp::cObject*, omnetpp::cObject*) override;
 
 private:
+    enum class Coverage : unsigned char { Unknown, Inside, Outside };
+
     void checkRegionOfInterest();
+    void classifyVehicles(const std::vector<BasicNodeManager::VehicleState>&);
+    void setOutside(std::shared_ptr<VehicleCache>);
+    void updateSubscription(VehicleCache&);
 
     SubscriptionManager* m_subscriptions;
     VehicleLifecycle* m_lifecycle;
     RegionsOfInterest m_regions;
-    std::unordered_set<std::string> m_outside;
+    bool m_reduce_subscriptions = false;
+    double m_subscription_margin = 0.0;
+    // caches of vehicles outside of regions indexed by vehicle handle
+    std::vector<std::shared_ptr<VehicleCache>> m_outside;
+    // buffers for batched region checks
+    std::vector<std::size_t> m_outside_handles;
+    std::vector<TraCIPosition> m_outside_positions;
+    // coverage of managed vehicles determined by latest vehicle snapshot indexed by vehicle handle
+    std::vector<Coverage> m_coverage;
+    std::vector<TraCIPosition> m_snapshot_positions;
 };
 
 } // namespace traci
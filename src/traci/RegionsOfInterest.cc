@@ -9,12 +9,57 @@
 #include <boost/geometry/geometries/register/point.hpp>
 #include <boost/lexical_cast.hpp>
 #include <omnetpp/clog.h>
+#include <algorithm>
+#include <cmath>
 
 BOOST_GEOMETRY_REGISTER_POINT_2D(libsumo::TraCIPosition, double, cs::cartesian, x, y)
 
 namespace traci
 {
 
+namespace
+{
+
+// grid resolution: cells are at least this large [m] and each axis has at most max_cells cells
+constexpr double min_cell_size = 10.0;
+constexpr std::size_t max_cells = 128;
+
+} // namespace
+
+RegionsOfInterest::PreparedRegion::PreparedRegion(Region&& poly) :
+    polygon(std::move(poly)), envelope(boost::geometry::return_envelope<Envelope>(polygon))
+{
+    auto add_ring = [this](const Region::ring_type& ring) {
+        for (std::size_t i = 0; i + 1 < ring.size(); ++i) {
+            const Point& a = ring[i];
+            const Point& b = ring[i + 1];
+            if (a.y() != b.y()) {
+                edges.push_back(Edge { a.x(), a.y(), b.y(), (b.x() - a.x()) / (b.y() - a.y()) });
+            }
+        }
+    };
+
+    add_ring(polygon.outer());
+    for (const auto& inner : polygon.inners()) {
+        add_ring(inner);
+    }
+}
+
+bool RegionsOfInterest::PreparedRegion::contains(double x, double y) const
+{
+    // crossing number test: holes are handled by even-odd rule
+    bool inside = false;
+    for (const Edge& edge : edges) {
+        if ((edge.y0 > y) != (edge.y1 > y)) {
+            const double cross = edge.x0 + (y - edge.y0) * edge.slope;
+            if (x < cross) {
+                inside = !inside;
+            }
+        }
+    }
+    return inside;
+}
+
 void RegionsOfInterest::initialize(const omnetpp::cXMLElement& regions, const Boundary& boundary)
 {
     using omnetpp::cXMLElement;
@@ -38,19 +83,121 @@ void RegionsOfInterest::initialize(const omnetpp::cXMLElement& regions, const Bo
             EV_WARN << "Region is out of scenario boundary!\n";
         }
     }
+
+    for (std::size_t i = 0; i < m_regions.size(); ++i) {
+        m_rtree.insert(RtreeValue { m_regions[i].envelope, i });
+    }
+    buildGrid();
+}
+
+void RegionsOfInterest::buildGrid()
+{
+    namespace bg = boost::geometry;
+    m_cells.clear();
+    if (m_regions.empty()) {
+        return;
+    }
+
+    bg::assign_inverse(m_grid_envelope);
+    for (const PreparedRegion& region : m_regions) {
+        bg::expand(m_grid_envelope, region.envelope);
+    }
+    const double width = m_grid_envelope.max_corner().x() - m_grid_envelope.min_corner().x();
+    const double height = m_grid_envelope.max_corner().y() - m_grid_envelope.min_corner().y();
+    m_cell_size = std::max(min_cell_size, std::max(width, height) / max_cells);
+    m_columns = static_cast<std::size_t>(width / m_cell_size) + 1;
+    m_rows = static_cast<std::size_t>(height / m_cell_size) + 1;
+    m_cells.resize(m_columns * m_rows, Cell::Outside);
+
+    std::vector<RtreeValue> candidates;
+    for (std::size_t row = 0; row < m_rows; ++row) {
+        for (std::size_t column = 0; column < m_columns; ++column) {
+            const Point min_corner {
+                m_grid_envelope.min_corner().x() + column * m_cell_size,
+                m_grid_envelope.min_corner().y() + row * m_cell_size };
+            const Point max_corner { min_corner.x() + m_cell_size, min_corner.y() + m_cell_size };
+            const Envelope cell_box { min_corner, max_corner };
+
+            candidates.clear();
+            m_rtree.query(bg::index::intersects(cell_box), std::back_inserter(candidates));
+            if (candidates.empty()) {
+                continue;
+            }
+
+            Region cell_region;
+            bg::convert(cell_box, cell_region);
+            Cell& cell = m_cells[row * m_columns + column];
+            for (const RtreeValue& candidate : candidates) {
+                const Region& region = m_regions[candidate.second].polygon;
+                if (bg::within(cell_region, region)) {
+                    cell = Cell::Inside;
+                    break;
+                } else if (bg::intersects(cell_region, region)) {
+                    cell = Cell::Boundary;
+                }
+            }
+        }
+    }
 }
 
 bool RegionsOfInterest::cover(const TraCIPosition& pos) const
 {
-    for (const auto& region : m_regions) {
-        if (boost::geometry::within(pos, region)) {
+    if (m_cells.empty()) {
+        return false;
+    }
+
+    const double dx = pos.x - m_grid_envelope.min_corner().x();
+    const double dy = pos.y - m_grid_envelope.min_corner().y();
+    if (dx < 0.0 || dy < 0.0) {
+        return false;
+    }
+
+    const std::size_t column = static_cast<std::size_t>(dx / m_cell_size);
+    const std::size_t row = static_cast<std::size_t>(dy / m_cell_size);
+    if (column >= m_columns || row >= m_rows) {
+        return false;
+    }
+
+    switch (m_cells[row * m_columns + column]) {
+        case Cell::Inside:
             return true;
-        }
+        case Cell::Boundary:
+            return coverBoundary(pos.x, pos.y);
+        default:
+            return false;
     }
+}
 
+std::vector<bool> RegionsOfInterest::cover(const std::vector<TraCIPosition>& positions) const
+{
+    std::vector<bool> covered(positions.size(), false);
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        covered[i] = cover(positions[i]);
+    }
+    return covered;
+}
+
+bool RegionsOfInterest::coverBoundary(double x, double y) const
+{
+    namespace bgi = boost::geometry::index;
+    const Point point { x, y };
+    for (auto it = m_rtree.qbegin(bgi::intersects(point)); it != m_rtree.qend(); ++it) {
+        if (m_regions[it->second].contains(x, y)) {
+            return true;
+        }
+    }
     return false;
 }
 
+bool RegionsOfInterest::near(const TraCIPosition& pos, double margin) const
+{
+    namespace bgi = boost::geometry::index;
+    const Envelope query {
+        Point { pos.x - margin, pos.y - margin },
+        Point { pos.x + margin, pos.y + margin } };
+    return m_rtree.qbegin(bgi::intersects(query)) != m_rtree.qend();
+}
+
 RegionsOfInterest::Region RegionsOfInterest::buildRegion(const Boundary& boundary)
 {
     using namespace boost::geometry;
@@ -9,28 +9,88 @@
 
 #include "traci/Boundary.h"
 #include "traci/Position.h"
+#include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/index/rtree.hpp>
 #include <omnetpp/cxmlelement.h>
-#include <list>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace traci
 {
 
+/**
+ * RegionsOfInterest checks if positions are covered by any of several polygons.
+ *
+ * Regions are indexed by an R-tree and a uniform grid: grid cells are classified as
+ * completely inside a region, outside of all regions or at a region boundary.
+ * Only positions in boundary cells are tested exactly against the edges of candidate regions.
+ */
 class RegionsOfInterest
 {
 public:
     using Point = boost::geometry::model::d2::point_xy<double>;
     using Region = boost::geometry::model::polygon<Point>;
+    using Envelope = boost::geometry::model::box<Point>;
 
     RegionsOfInterest() = default;
     void initialize(const omnetpp::cXMLElement&, const Boundary&);
     bool cover(const TraCIPosition&) const;
+
+    /**
+     * Check several positions at once
+     * \param positions positions to check
+     * \return flags for each position in same order, true if covered by a region
+     */
+    std::vector<bool> cover(const std::vector<TraCIPosition>& positions) const;
+
+    /**
+     * Check if position is near any region, i.e. within a region's bounding box extended by margin
+     * \param pos position to check
+     * \param margin extension of bounding boxes in all directions [m]
+     */
+    bool near(const TraCIPosition& pos, double margin) const;
+
     std::size_t size() const { return m_regions.size(); }
     bool empty() const { return m_regions.empty(); }
 
 private:
-    std::list<Region> m_regions;
+    struct Edge
+    {
+        double x0, y0;
+        double y1;
+        double slope; // dx/dy of edge
+    };
+
+    struct PreparedRegion
+    {
+        Region polygon;
+        Envelope envelope;
+        std::vector<Edge> edges;
+
+        explicit PreparedRegion(Region&&);
+        bool contains(double x, double y) const;
+    };
+
+    enum class Cell : std::uint8_t { Outside, Inside, Boundary };
+
+    using RtreeValue = std::pair<Envelope, std::size_t>;
+    using Rtree = boost::geometry::index::rtree<RtreeValue, boost::geometry::index::quadratic<16>>;
+
+    void buildGrid();
+    bool coverBoundary(double x, double y) const;
+
+    std::vector<PreparedRegion> m_regions;
+    Rtree m_rtree;
+
+    // uniform grid covering all regions
+    Envelope m_grid_envelope;
+    double m_cell_size = 0.0;
+    std::size_t m_columns = 0;
+    std::size_t m_rows = 0;
+    std::vector<Cell> m_cells;
 
     static Region buildRegion(const Boundary&);
 };
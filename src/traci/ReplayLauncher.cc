@@ -0,0 +1,59 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/ReplayLauncher.h"
+#include "traci/TraceConnection.h"
+#include "traci/TraceFile.h"
+
+namespace traci
+{
+
+Define_Module(ReplayLauncher)
+
+void ReplayLauncher::initialize()
+{
+    m_trace_file = par("traceFile").stringValue();
+    m_reject_writes = par("rejectWriteCommands");
+}
+
+void ReplayLauncher::finish()
+{
+    recordScalar("ignoredWriteCommands", m_ignored_writes);
+}
+
+ServerEndpoint ReplayLauncher::launch()
+{
+    std::shared_ptr<const TraceReader> trace;
+    try {
+        trace = std::make_shared<const TraceReader>(m_trace_file);
+    } catch (std::exception& e) {
+        throw omnetpp::cRuntimeError("Loading TraCI trace failed: %s", e.what());
+    }
+    EV_INFO << "Replaying " << trace->steps() << " simulation steps from " << m_trace_file << "\n";
+
+    ServerEndpoint endpoint;
+    endpoint.hostname = "replay";
+    endpoint.port = 0;
+    endpoint.connection = [this, trace]() {
+        auto handler = [this](int command) { return handleWriteCommand(command); };
+        return std::unique_ptr<tcpip::Socket> { new ReplayConnection(trace, handler) };
+    };
+    return endpoint;
+}
+
+bool ReplayLauncher::handleWriteCommand(int command)
+{
+    if (m_reject_writes) {
+        return false;
+    }
+
+    if (m_ignored_writes++ == 0) {
+        EV_WARN << "TraCI write commands have no effect in replay mode (first command 0x" << std::hex << command << std::dec << ")\n";
+    }
+    return true;
+}
+
+} // namespace traci
@@ -0,0 +1,40 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef REPLAYLAUNCHER_H_J6TB4QWS
+#define REPLAYLAUNCHER_H_J6TB4QWS
+
+#include "traci/Launcher.h"
+#include <omnetpp/csimplemodule.h>
+#include <string>
+
+namespace traci
+{
+
+/**
+ * ReplayLauncher feeds TraCI responses recorded by traci::Core (traceFile parameter)
+ * to the TraCI client, i.e. no SUMO process is required.
+ */
+class ReplayLauncher : public Launcher, public omnetpp::cSimpleModule
+{
+public:
+    ServerEndpoint launch() override;
+
+protected:
+    void initialize() override;
+    void finish() override;
+
+private:
+    bool handleWriteCommand(int command);
+
+    std::string m_trace_file;
+    bool m_reject_writes;
+    unsigned m_ignored_writes = 0;
+};
+
+} // namespace traci
+
+#endif /* REPLAYLAUNCHER_H_J6TB4QWS */
@@ -0,0 +1,288 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/SubscriptionDecoder.h"
+#include "traci/VariableCache.h"
+#include "traci/sumo/libsumo/TraCIConstants.h"
+#include <cstdint>
+#include <cstring>
+
+namespace traci
+{
+
+namespace
+{
+
+inline std::uint32_t load_be32(const unsigned char* p)
+{
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap32(value);
+#elif !defined(__BYTE_ORDER__)
+    value = (std::uint32_t(p[0]) << 24) | (std::uint32_t(p[1]) << 16) | (std::uint32_t(p[2]) << 8) | std::uint32_t(p[3]);
+#endif
+    return value;
+}
+
+inline std::uint64_t load_be64(const unsigned char* p)
+{
+    std::uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    value = __builtin_bswap64(value);
+#elif !defined(__BYTE_ORDER__)
+    value = (std::uint64_t(load_be32(p)) << 32) | load_be32(p + 4);
+#endif
+    return value;
+}
+
+/**
+ * Create a result object for a variable in results' map
+ */
+template<typename R>
+R& emplace(SubscriptionDecoder::Results& results, int variable)
+{
+    auto result = std::make_shared<R>();
+    R& ref = *result;
+    (*results.values)[variable] = std::move(result);
+    return ref;
+}
+
+} // namespace
+
+class SubscriptionDecoder::Reader
+{
+public:
+    Reader(const unsigned char* data, std::size_t length) : m_data(data), m_end(data + length) {}
+
+    const unsigned char* position() const { return m_data; }
+
+    void seek(const unsigned char* position)
+    {
+        if (position > m_end) {
+            throw libsumo::TraCIException("subscription response exceeds message length");
+        }
+        m_data = position;
+    }
+
+    int readUnsignedByte()
+    {
+        check(1);
+        return *m_data++;
+    }
+
+    int readInt()
+    {
+        check(4);
+        const std::uint32_t value = load_be32(m_data);
+        m_data += 4;
+        return static_cast<std::int32_t>(value);
+    }
+
+    double readDouble()
+    {
+        check(8);
+        const std::uint64_t bits = load_be64(m_data);
+        m_data += 8;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    void readString(std::string& value)
+    {
+        const int length = readInt();
+        if (length < 0) {
+            throw libsumo::TraCIException("negative string length in subscription response");
+        }
+        check(length);
+        value.assign(reinterpret_cast<const char*>(m_data), length);
+        m_data += length;
+    }
+
+private:
+    void check(std::size_t bytes) const
+    {
+        if (static_cast<std::size_t>(m_end - m_data) < bytes) {
+            throw libsumo::TraCIException("subscription response is truncated");
+        }
+    }
+
+    const unsigned char* m_data;
+    const unsigned char* m_end;
+};
+
+int SubscriptionDecoder::decodeStep(const unsigned char* data, std::size_t length, Target& target)
+{
+    Reader reader(data, length);
+    const int count = reader.readInt();
+    m_staging = true;
+
+    for (int i = 0; i < count; ++i) {
+        decodeResponse(reader, target);
+    }
+
+    return count;
+}
+
+void SubscriptionDecoder::decodeSubscriptions(const unsigned char* data, std::size_t length, int command, int count, bool values, Target& target)
+{
+    Reader reader(data, length);
+    m_staging = false;
+    for (int i = 0; i < count; ++i) {
+        const unsigned char* start = reader.position();
+        std::size_t status_length = reader.readUnsignedByte();
+        if (status_length == 0) {
+            status_length = reader.readInt();
+        }
+        const int status_command = reader.readUnsignedByte();
+        const int status = reader.readUnsignedByte();
+        reader.readString(m_description);
+        reader.seek(start + status_length);
+
+        if (status_command != command) {
+            throw libsumo::TraCIException("received status response to command " + std::to_string(status_command) +
+                    " but expected " + std::to_string(command));
+        } else if (status != libsumo::RTYPE_OK) {
+            throw libsumo::TraCIException("subscription command " + std::to_string(command) +
+                    " failed with status " + std::to_string(status) + " [description: " + m_description + "]");
+        }
+
+        if (values) {
+            decodeResponse(reader, target);
+        }
+    }
+}
+
+void SubscriptionDecoder::decodeResponse(Reader& reader, Target& target)
+{
+    const unsigned char* start = reader.position();
+    std::size_t command_length = reader.readUnsignedByte();
+    if (command_length == 0) {
+        command_length = reader.readInt();
+    }
+    const unsigned char* end = start + command_length;
+    const int response = reader.readUnsignedByte();
+
+    if (response >= libsumo::RESPONSE_SUBSCRIBE_INDUCTIONLOOP_VARIABLE && response <= libsumo::RESPONSE_SUBSCRIBE_PERSON_VARIABLE) {
+        reader.readString(m_id);
+        Results results = target.getVariableResults(response, m_id);
+        if (results.cache || results.values) {
+            const int variables = reader.readUnsignedByte();
+            decodeVariables(reader, variables, results);
+        } else {
+            reader.seek(end);
+        }
+    } else if (response >= libsumo::RESPONSE_SUBSCRIBE_INDUCTIONLOOP_CONTEXT && response <= libsumo::RESPONSE_SUBSCRIBE_PERSON_CONTEXT) {
+        reader.readString(m_context);
+        reader.readUnsignedByte(); // context domain
+        const int variables = reader.readUnsignedByte();
+        const int objects = reader.readInt();
+        for (int j = 0; j < objects; ++j) {
+            reader.readString(m_id);
+            Results results = target.getContextResults(response + 0x50, m_context, m_id);
+            if (!results.cache && !results.values) {
+                throw libsumo::TraCIException("no storage for context subscription of " + m_context);
+            }
+            decodeVariables(reader, variables, results);
+        }
+    } else {
+        throw libsumo::TraCIException("unexpected subscription response " + std::to_string(response));
+    }
+}
+
+template<typename T>
+T* SubscriptionDecoder::slot(Results& results, int variable)
+{
+    if (!results.cache) {
+        return nullptr;
+    }
+    return m_staging ? results.cache->stage<T>(variable) : results.cache->store<T>(variable);
+}
+
+void SubscriptionDecoder::decodeVariables(Reader& reader, int count, Results& results)
+{
+    for (int i = 0; i < count; ++i) {
+        const int variable = reader.readUnsignedByte();
+        const int status = reader.readUnsignedByte();
+        const int type = reader.readUnsignedByte();
+
+        if (status != libsumo::RTYPE_OK) {
+            throw libsumo::TraCIException("Subscription response error: variableID=" + std::to_string(variable) + " status=" + std::to_string(status));
+        }
+
+        switch (type) {
+            case libsumo::TYPE_DOUBLE: {
+                const double value = reader.readDouble();
+                if (double* target = slot<double>(results, variable)) {
+                    *target = value;
+                } else if (results.values) {
+                    emplace<libsumo::TraCIDouble>(results, variable).value = value;
+                }
+                break;
+            }
+            case libsumo::TYPE_INTEGER: {
+                const int value = reader.readInt();
+                if (int* target = slot<int>(results, variable)) {
+                    *target = value;
+                } else if (results.values) {
+                    emplace<libsumo::TraCIInt>(results, variable).value = value;
+                }
+                break;
+            }
+            case libsumo::TYPE_STRING: {
+                std::string* target = slot<std::string>(results, variable);
+                if (!target) {
+                    target = results.values ? &emplace<libsumo::TraCIString>(results, variable).value : &m_scratch;
+                }
+                reader.readString(*target);
+                break;
+            }
+            case libsumo::POSITION_2D:
+            case libsumo::POSITION_3D: {
+                libsumo::TraCIPosition* target = slot<libsumo::TraCIPosition>(results, variable);
+                if (!target) {
+                    target = results.values ? &emplace<libsumo::TraCIPosition>(results, variable) : &m_scratch_position;
+                }
+                target->x = reader.readDouble();
+                target->y = reader.readDouble();
+                target->z = type == libsumo::POSITION_3D ? reader.readDouble() : 0.0;
+                break;
+            }
+            case libsumo::TYPE_COLOR: {
+                libsumo::TraCIColor color;
+                color.r = reader.readUnsignedByte();
+                color.g = reader.readUnsignedByte();
+                color.b = reader.readUnsignedByte();
+                color.a = reader.readUnsignedByte();
+                if (results.values) {
+                    emplace<libsumo::TraCIColor>(results, variable) = color;
+                }
+                break;
+            }
+            case libsumo::TYPE_STRINGLIST: {
+                std::vector<std::string>* target = slot<std::vector<std::string>>(results, variable);
+                if (!target) {
+                    target = results.values ? &emplace<libsumo::TraCIStringList>(results, variable).value : &m_scratch_list;
+                }
+                const int size = reader.readInt();
+                if (size < 0) {
+                    throw libsumo::TraCIException("negative string list length in subscription response");
+                }
+                target->resize(size);
+                for (std::string& item : *target) {
+                    reader.readString(item);
+                }
+                break;
+            }
+            default:
+                throw libsumo::TraCIException("Unimplemented subscription type: " + std::to_string(type));
+        }
+    }
+}
+
+} // namespace traci
@@ -0,0 +1,125 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef SUBSCRIPTIONDECODER_H_K4TX9RMB
+#define SUBSCRIPTIONDECODER_H_K4TX9RMB
+
+#include "traci/sumo/libsumo/TraCIDefs.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace traci
+{
+
+class VariableCache;
+
+/**
+ * SubscriptionDecoder parses subscription responses of a simulation step from a contiguous buffer.
+ *
+ * Unlike TraCIAPI's decoding via tcpip::Storage, values are read by bulk loads and written
+ * directly into the storage given by a target. Variables with a slot in a VariableCache are
+ * decoded in place, i.e. steady-state decoding does not allocate memory.
+ */
+class SubscriptionDecoder
+{
+public:
+    /**
+     * Storage for an object's subscribed variables
+     */
+    struct Results
+    {
+        // decoded values are stored in cache slots, variables without slot go to values
+        VariableCache* cache = nullptr;
+        // decoded values are stored here, object is skipped if neither cache nor values are given
+        libsumo::TraCIResults* values = nullptr;
+    };
+
+    class Target
+    {
+    public:
+        virtual ~Target() = default;
+
+        /**
+         * Invoked once before responses of a simulation step are decoded
+         *
+         * This may be invoked by a background thread, see API::requestSimulationStep.
+         */
+        virtual void prepareDecoding() {}
+
+        /**
+         * Invoked once by the main thread when decoded responses of a simulation step become current
+         *
+         * Values decoded into cache slots by decodeStep are staged until then.
+         */
+        virtual void commitDecoding() {}
+
+        /**
+         * Look up storage for a variable subscription response
+         * \param response TraCI response command identifying the domain
+         * \param id object identifier
+         */
+        virtual Results getVariableResults(int response, const std::string& id) = 0;
+
+        /**
+         * Look up storage for an object of a context subscription response
+         * \param response TraCI response command of variable subscriptions in the context's domain
+         * \param context identifier of context object
+         * \param id object identifier
+         */
+        virtual Results getContextResults(int response, const std::string& context, const std::string& id) = 0;
+    };
+
+    /**
+     * Decode subscription responses following a simulation step's status response
+     *
+     * Values are stored in the staging buffers of cache slots, i.e. current values stay untouched.
+     * \param data begins with number of subscription responses
+     * \param length number of bytes available at data
+     * \param target storage of decoded values
+     * \return number of decoded subscription responses
+     */
+    int decodeStep(const unsigned char* data, std::size_t length, Target& target);
+
+    /**
+     * Decode responses to a batch of variable subscription commands sent in a single message
+     *
+     * Each command is answered by a status response, which is followed by a subscription response
+     * with the initial values unless the command's variable list has been empty.
+     * Initial values are stored in the current cache slots.
+     * \param data begins with first status response
+     * \param length number of bytes available at data
+     * \param command subscription command, e.g. CMD_SUBSCRIBE_VEHICLE_VARIABLE
+     * \param count number of subscription commands
+     * \param values true if subscription responses follow status responses
+     * \param target storage of decoded values
+     */
+    void decodeSubscriptions(const unsigned char* data, std::size_t length, int command, int count, bool values, Target& target);
+
+private:
+    class Reader;
+
+    void decodeResponse(Reader&, Target&);
+    void decodeVariables(Reader&, int count, Results&);
+
+    template<typename T>
+    T* slot(Results&, int variable);
+
+    // identifiers are decoded into reused string buffers
+    std::string m_id;
+    std::string m_context;
+    std::string m_description;
+    // sink of values lacking storage
+    std::string m_scratch;
+    std::vector<std::string> m_scratch_list;
+    libsumo::TraCIPosition m_scratch_position;
+    // cache slots are written to staging buffers
+    bool m_staging = false;
+};
+
+} // namespace traci
+
+#endif /* SUBSCRIPTIONDECODER_H_K4TX9RMB */
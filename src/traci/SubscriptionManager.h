@@ -7,6 +7,7 @@
 #ifndef SUBSCRIPTIONMANAGER_H_4WCPHLVR
 #define SUBSCRIPTIONMANAGER_H_4WCPHLVR
 
+#include "traci/IdInterner.h"
 #include <memory>
 #include <set>
 #include <string>
@@ -29,12 +30,46 @@ public:
     virtual void subscribePersonVariables(const std::set<int>& personVariables) = 0;
     virtual void subscribeVehicleVariables(const std::set<int>& vehicleVariables) = 0;
     virtual void subscribeSimulationVariables(const std::set<int>& simulationVariables) = 0;
+
+    /**
+     * Add variables to reduced vehicle subscriptions
+     *
+     * Vehicles not simulated by Artery (e.g. outside regions of interest) can be switched
+     * to a reduced subscription to save TraCI traffic while still monitoring them.
+     */
+    virtual void subscribeReducedVehicleVariables(const std::set<int>& vehicleVariables) = 0;
+
+    /**
+     * Switch between complete and reduced subscription of a vehicle
+     *
+     * Switches are collected and reissued in one batch by commitVehicleSubscriptions,
+     * i.e. cached values of a switched vehicle are not refreshed until then.
+     * \param id vehicle ID
+     * \param reduced true to subscribe only reduced vehicle variables
+     */
+    virtual void setVehicleSubscriptionReduced(const std::string& id, bool reduced) = 0;
+
+    /**
+     * Reissue subscriptions of all vehicles switched since last commit
+     *
+     * Initial results are stored in the vehicles' caches. Pending switches are committed by step() at the latest.
+     */
+    virtual void commitVehicleSubscriptions() = 0;
     virtual const std::unordered_set<std::string>& getSubscribedPersons() const = 0;
     virtual const std::unordered_set<std::string>& getSubscribedVehicles() const = 0;
     virtual const std::unordered_map<std::string, std::shared_ptr<VehicleCache>>& getAllVehicleCaches() const = 0;
     virtual std::shared_ptr<PersonCache> getPersonCache(const std::string& id) = 0;
     virtual std::shared_ptr<VehicleCache> getVehicleCache(const std::string& id) = 0;
     virtual std::shared_ptr<SimulationCache> getSimulationCache() = 0;
+
+    /**
+     * Handles of persons and vehicles known to SUMO
+     *
+     * Handles are assigned on departure and released one step after arrival,
+     * i.e. handles of arrived objects are still valid while the arrival is processed.
+     */
+    virtual const IdInterner& getPersonIds() const = 0;
+    virtual const IdInterner& getVehicleIds() const = 0;
 };
 
 } // namespace traci
@@ -0,0 +1,106 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/TraceConnection.h"
+#include "traci/sumo/foreign/tcpip/storage.h"
+#include "traci/sumo/libsumo/TraCIConstants.h"
+
+namespace traci
+{
+
+RecordingConnection::RecordingConnection(std::unique_ptr<tcpip::Socket> connection, const std::string& path) :
+    tcpip::Socket("recording", 0), m_connection(std::move(connection)), m_writer(path)
+{
+}
+
+void RecordingConnection::sendExact(const tcpip::Storage& msg)
+{
+    m_request.assign(msg.begin(), msg.end());
+    m_connection->sendExact(msg);
+}
+
+bool RecordingConnection::receiveExact(tcpip::Storage& msg)
+{
+    const bool received = m_connection->receiveExact(msg);
+    if (received) {
+        const unsigned char* response = msg.size() > 0 ? &*msg.begin() : nullptr;
+        m_writer.write(m_request.data(), m_request.size(), response, msg.size());
+        m_request.clear();
+    }
+    return received;
+}
+
+void RecordingConnection::close()
+{
+    m_writer.flush();
+    m_connection->close();
+}
+
+ReplayConnection::ReplayConnection(std::shared_ptr<const TraceReader> trace, WriteHandler handler) :
+    tcpip::Socket("replay", 0), m_trace(trace), m_write_handler(handler)
+{
+}
+
+void ReplayConnection::sendExact(const tcpip::Storage& msg)
+{
+    m_request.assign(msg.begin(), msg.end());
+}
+
+bool ReplayConnection::receiveExact(tcpip::Storage& msg)
+{
+    msg.reset();
+    const int command = TraceReader::command(m_request.data(), m_request.size());
+
+    if (command == libsumo::CMD_SIMSTEP) {
+        if (m_step < m_trace->steps()) {
+            const TraceReader::Response& response = m_trace->step(m_step++);
+            msg.writePacket(const_cast<unsigned char*>(response.data), response.length);
+        } else {
+            writeStatus(msg, command, libsumo::RTYPE_ERR, "trace contains no further simulation steps");
+        }
+    } else if (command == libsumo::CMD_SETORDER || command == libsumo::CMD_CLOSE) {
+        writeStatus(msg, command, libsumo::RTYPE_OK, "");
+    } else if (isWriteCommand(command)) {
+        if (m_write_handler && m_write_handler(command)) {
+            writeStatus(msg, command, libsumo::RTYPE_OK, "");
+        } else {
+            writeStatus(msg, command, libsumo::RTYPE_ERR, "write commands are rejected in replay mode");
+        }
+    } else {
+        std::string_view request { reinterpret_cast<const char*>(m_request.data()), m_request.size() };
+        const TraceReader::Response response = m_trace->find(request, m_step);
+        if (response.data) {
+            msg.writePacket(const_cast<unsigned char*>(response.data), response.length);
+        } else {
+            writeStatus(msg, command, libsumo::RTYPE_ERR, "request has not been recorded at this step in trace");
+        }
+    }
+
+    m_request.clear();
+    return true;
+}
+
+void ReplayConnection::close()
+{
+    m_request.clear();
+}
+
+bool ReplayConnection::isWriteCommand(int command)
+{
+    return (command >= libsumo::CMD_SET_INDUCTIONLOOP_VARIABLE && command <= libsumo::CMD_SET_BUSSTOP_VARIABLE) ||
+        (command >= libsumo::CMD_SET_PARKINGAREA_VARIABLE && command <= libsumo::CMD_SET_OVERHEADWIRE_VARIABLE) ||
+        command == libsumo::CMD_LOAD || command == libsumo::CMD_LOAD_SIMSTATE;
+}
+
+void ReplayConnection::writeStatus(tcpip::Storage& msg, int command, int status, const std::string& description)
+{
+    msg.writeUnsignedByte(1 + 1 + 1 + 4 + static_cast<int>(description.size()));
+    msg.writeUnsignedByte(command);
+    msg.writeUnsignedByte(status);
+    msg.writeString(description);
+}
+
+} // namespace traci
@@ -0,0 +1,76 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef TRACECONNECTION_H_M3KD9VYT
+#define TRACECONNECTION_H_M3KD9VYT
+
+#include "traci/TraceFile.h"
+#include "traci/sumo/foreign/tcpip/socket.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * RecordingConnection forwards TraCI messages to another connection and records them in a trace file.
+ */
+class RecordingConnection : public tcpip::Socket
+{
+public:
+    RecordingConnection(std::unique_ptr<tcpip::Socket> connection, const std::string& path);
+
+    void sendExact(const tcpip::Storage&) override;
+    bool receiveExact(tcpip::Storage&) override;
+    void close() override;
+
+private:
+    std::unique_ptr<tcpip::Socket> m_connection;
+    TraceWriter m_writer;
+    std::vector<unsigned char> m_request;
+};
+
+/**
+ * ReplayConnection answers TraCI requests by responses recorded in a trace file.
+ *
+ * Simulation steps are replayed in recorded order. Other requests are answered by
+ * the response recorded for an identical request, preferably at the same simulation step.
+ * Unknown requests are answered by an error status, i.e. TraCIAPI throws a TraCIException.
+ */
+class ReplayConnection : public tcpip::Socket
+{
+public:
+    /**
+     * Handler of write commands (these cannot take effect in a replay)
+     * \return true if write command shall be acknowledged, false to answer by an error
+     */
+    using WriteHandler = std::function<bool(int command)>;
+
+    ReplayConnection(std::shared_ptr<const TraceReader> trace, WriteHandler);
+
+    void sendExact(const tcpip::Storage&) override;
+    bool receiveExact(tcpip::Storage&) override;
+    void close() override;
+
+    /**
+     * Check if command modifies the simulation state
+     */
+    static bool isWriteCommand(int command);
+
+private:
+    void writeStatus(tcpip::Storage&, int command, int status, const std::string& description);
+
+    std::shared_ptr<const TraceReader> m_trace;
+    WriteHandler m_write_handler;
+    std::vector<unsigned char> m_request;
+    std::size_t m_step = 0;
+};
+
+} // namespace traci
+
+#endif /* TRACECONNECTION_H_M3KD9VYT */
@@ -0,0 +1,162 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/TraceFile.h"
+#include "traci/sumo/libsumo/TraCIConstants.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace traci
+{
+
+namespace
+{
+
+const char magic[8] = { 'A', 'R', 'T', 'R', 'A', 'C', 'E', '1' };
+
+std::uint32_t load_le32(const unsigned char* p)
+{
+    return std::uint32_t(p[0]) | (std::uint32_t(p[1]) << 8) | (std::uint32_t(p[2]) << 16) | (std::uint32_t(p[3]) << 24);
+}
+
+std::runtime_error trace_error(const std::string& path, const std::string& what)
+{
+    return std::runtime_error("TraCI trace " + path + ": " + what);
+}
+
+} // namespace
+
+TraceWriter::TraceWriter(const std::string& path) :
+    m_stream(path, std::ios::binary | std::ios::trunc)
+{
+    if (!m_stream) {
+        throw trace_error(path, "cannot be created");
+    }
+    m_stream.write(magic, sizeof(magic));
+}
+
+void TraceWriter::write(const unsigned char* request, std::size_t request_length, const unsigned char* response, std::size_t response_length)
+{
+    writeMessage(request, request_length);
+    writeMessage(response, response_length);
+}
+
+void TraceWriter::writeMessage(const unsigned char* data, std::size_t length)
+{
+    const std::uint32_t value = static_cast<std::uint32_t>(length);
+    const char prefix[4] = {
+        static_cast<char>(value & 0xff), static_cast<char>((value >> 8) & 0xff),
+        static_cast<char>((value >> 16) & 0xff), static_cast<char>((value >> 24) & 0xff)
+    };
+    m_stream.write(prefix, sizeof(prefix));
+    m_stream.write(reinterpret_cast<const char*>(data), length);
+}
+
+void TraceWriter::flush()
+{
+    m_stream.flush();
+}
+
+TraceReader::TraceReader(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw trace_error(path, std::strerror(errno));
+    }
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(sizeof(magic))) {
+        ::close(fd);
+        throw trace_error(path, "is not a trace file");
+    }
+
+    m_length = status.st_size;
+    void* mapping = ::mmap(nullptr, m_length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw trace_error(path, std::strerror(errno));
+    }
+    m_data = static_cast<const unsigned char*>(mapping);
+
+    try {
+        if (std::memcmp(m_data, magic, sizeof(magic)) != 0) {
+            throw trace_error(path, "is not a trace file");
+        }
+        buildIndex();
+    } catch (...) {
+        ::munmap(const_cast<unsigned char*>(m_data), m_length);
+        throw;
+    }
+}
+
+TraceReader::~TraceReader()
+{
+    ::munmap(const_cast<unsigned char*>(m_data), m_length);
+}
+
+void TraceReader::buildIndex()
+{
+    const unsigned char* position = m_data + sizeof(magic);
+    const unsigned char* end = m_data + m_length;
+    auto next = [&position, end](Response& message) {
+        if (end - position < 4) {
+            return false;
+        }
+        message.length = load_le32(position);
+        message.data = position + 4;
+        if (static_cast<std::size_t>(end - message.data) < message.length) {
+            return false;
+        }
+        position = message.data + message.length;
+        return true;
+    };
+
+    Response request;
+    Response response;
+    // a truncated last record (e.g. crashed recording) is ignored
+    while (next(request) && next(response)) {
+        if (command(request.data, request.length) == libsumo::CMD_SIMSTEP) {
+            m_steps.push_back(response);
+        } else {
+            std::string_view key { reinterpret_cast<const char*>(request.data), request.length };
+            m_requests[key].push_back(Entry { m_steps.size(), response });
+        }
+    }
+}
+
+TraceReader::Response TraceReader::find(std::string_view request, std::size_t step) const
+{
+    auto found = m_requests.find(request);
+    if (found == m_requests.end()) {
+        return Response {};
+    }
+
+    // entries are ordered by step: pick first entry recorded at given step
+    const auto& entries = found->second;
+    auto it = std::lower_bound(entries.begin(), entries.end(), step,
+            [](const Entry& entry, std::size_t step) { return entry.step < step; });
+    return it != entries.end() && it->step == step ? it->response : Response {};
+}
+
+int TraceReader::command(const unsigned char* message, std::size_t length)
+{
+    if (length >= 2 && message[0] != 0) {
+        return message[1];
+    } else if (length >= 6 && message[0] == 0) {
+        return message[5];
+    } else {
+        return -1;
+    }
+}
+
+} // namespace traci
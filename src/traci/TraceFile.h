@@ -0,0 +1,118 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef TRACEFILE_H_R8VNC2XE
+#define TRACEFILE_H_R8VNC2XE
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * TraceWriter records TraCI request and response messages to a binary trace file.
+ *
+ * A trace file starts with a magic tag followed by exchange records. Each record consists of
+ * a request message and its response message, both preceded by their length (32 bit, little endian).
+ * Messages are stored in TraCI wire format without message length.
+ */
+class TraceWriter
+{
+public:
+    /**
+     * Create trace file, an existing file is overwritten
+     * \param path trace file path
+     */
+    explicit TraceWriter(const std::string& path);
+
+    void write(const unsigned char* request, std::size_t request_length, const unsigned char* response, std::size_t response_length);
+    void flush();
+
+private:
+    void writeMessage(const unsigned char* data, std::size_t length);
+
+    std::ofstream m_stream;
+};
+
+/**
+ * TraceReader provides the records of a trace file by mapping it into memory.
+ *
+ * Responses to simulation step requests are kept in order. All other responses
+ * are indexed by their request message and the number of preceding simulation steps.
+ */
+class TraceReader
+{
+public:
+    struct Response
+    {
+        const unsigned char* data = nullptr;
+        std::size_t length = 0;
+    };
+
+    /**
+     * Map trace file into memory and build index of its records
+     * \param path trace file path
+     */
+    explicit TraceReader(const std::string& path);
+    ~TraceReader();
+
+    TraceReader(const TraceReader&) = delete;
+    TraceReader& operator=(const TraceReader&) = delete;
+
+    /**
+     * Number of recorded simulation steps
+     */
+    std::size_t steps() const { return m_steps.size(); }
+
+    /**
+     * Get recorded response of a simulation step
+     * \param step zero-based index of simulation step
+     */
+    const Response& step(std::size_t step) const { return m_steps.at(step); }
+
+    /**
+     * Look up recorded response of a request
+     *
+     * Only responses recorded at the given step are accepted, responses of other steps
+     * may not reflect the simulation state at this step. If a request has been recorded
+     * several times at this step, the first response is returned.
+     *
+     * \param request request message
+     * \param step number of simulation steps completed so far
+     * \return response, data is nullptr if request has not been recorded at this step
+     */
+    Response find(std::string_view request, std::size_t step) const;
+
+    /**
+     * Extract identifier of a message's first command
+     * \param message TraCI message without message length
+     * \return command identifier or -1 for malformed messages
+     */
+    static int command(const unsigned char* message, std::size_t length);
+
+private:
+    struct Entry
+    {
+        std::size_t step;
+        Response response;
+    };
+
+    void buildIndex();
+
+    const unsigned char* m_data = nullptr;
+    std::size_t m_length = 0;
+    std::vector<Response> m_steps;
+    std::unordered_map<std::string_view, std::vector<Entry>> m_requests;
+};
+
+} // namespace traci
+
+#endif /* TRACEFILE_H_R8VNC2XE */
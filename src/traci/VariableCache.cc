@@ -5,18 +5,109 @@
  */
 
 #include "traci/VariableCache.h"
+#include <utility>
 
 namespace traci
 {
 
-VariableCache::VariableCache(std::shared_ptr<API> api, int command, const std::string& id) :
-    TraCIScopeWrapper(*api, command, 0, 0, 0), m_api(api), m_id(id)
+VariableCache::VariableCache(std::shared_ptr<API> api, int command, const std::string& id, IdInterner::Handle handle) :
+    TraCIScopeWrapper(*api, command, 0, 0, 0), m_api(api), m_id(id), m_handle(handle)
 {
 }
 
 void VariableCache::reset(const libsumo::TraCIResults& values)
 {
-    m_values = values;
+    invalidate();
+    for (const auto& value : values) {
+        const libsumo::TraCIResult& result = *value.second;
+        assign(value.first, result);
+    }
+}
+
+void VariableCache::reset(libsumo::TraCIResults&& values)
+{
+    invalidate();
+    for (auto& value : values) {
+        if (value.second.use_count() == 1) {
+            assign(value.first, *value.second);
+        } else {
+            const libsumo::TraCIResult& result = *value.second;
+            assign(value.first, result);
+        }
+    }
+    values.clear();
+}
+
+void VariableCache::commitStaged()
+{
+    const SlotMask previous = m_valid;
+    std::swap(m_slots, m_staged_slots);
+    m_valid = m_staged_valid;
+    m_staged_valid = 0;
+    keepStatic(previous, StaticVariables {});
+}
+
+template<int... VARS>
+void VariableCache::keepStatic(SlotMask previous, std::integer_sequence<int, VARS...>)
+{
+    static_assert(((variable_slot(VARS) >= 0) && ...), "static variables require a slot");
+    // previous values are located in staging buffers after swap
+    auto keep = [this, previous](auto slot) {
+        constexpr SlotMask mask = slot_mask(decltype(slot)::value);
+        if ((previous & mask) && !(m_valid & mask)) {
+            std::get<decltype(slot)::value>(m_slots) = std::get<decltype(slot)::value>(m_staged_slots);
+            m_valid |= mask;
+        }
+    };
+    (keep(std::integral_constant<int, variable_slot(VARS)> {}), ...);
+}
+
+template<typename RESULT>
+void VariableCache::assign(int var, RESULT& result)
+{
+    using namespace libsumo;
+    // string buffers are taken over unless result is read-only
+    constexpr bool movable = !std::is_const<RESULT>::value;
+    using string_result = std::conditional_t<movable, TraCIString, const TraCIString>;
+    using string_list_result = std::conditional_t<movable, TraCIStringList, const TraCIStringList>;
+
+    // variables without slot are dropped because they are not accessible by get() anyway
+    if (auto d = dynamic_cast<const TraCIDouble*>(&result)) {
+        if (auto slot = store<double>(var)) {
+            *slot = d->value;
+        }
+    } else if (auto i = dynamic_cast<const TraCIInt*>(&result)) {
+        if (auto slot = store<int>(var)) {
+            *slot = i->value;
+        }
+    } else if (auto pos = dynamic_cast<const TraCIPosition*>(&result)) {
+        if (auto slot = store<TraCIPosition>(var)) {
+            *slot = *pos;
+        }
+    } else if (auto str = dynamic_cast<string_result*>(&result)) {
+        if (auto slot = store<std::string>(var)) {
+            if constexpr (movable) {
+                *slot = std::move(str->value);
+            } else {
+                *slot = str->value;
+            }
+        }
+    } else if (auto list = dynamic_cast<string_list_result*>(&result)) {
+        if (auto slot = store<std::vector<std::string>>(var)) {
+            if constexpr (movable) {
+                *slot = std::move(list->value);
+            } else {
+                *slot = list->value;
+            }
+        }
+    }
+}
+
+SubscriptionDecoder::Results VariableCache::getDecoderResults()
+{
+    SubscriptionDecoder::Results results;
+    results.cache = this;
+    return results;
 }
 
 SimulationCache::SimulationCache(std::shared_ptr<API> api) :
@@ -24,13 +115,13 @@ SimulationCache::SimulationCache(std::shared_ptr<API> api) :
 {
 }
 
-PersonCache::PersonCache(std::shared_ptr<API> api, const std::string& personID) :
-    VariableCache(api, libsumo::CMD_GET_PERSON_VARIABLE, personID)
+PersonCache::PersonCache(std::shared_ptr<API> api, const std::string& personID, IdInterner::Handle handle) :
+    VariableCache(api, libsumo::CMD_GET_PERSON_VARIABLE, personID, handle)
 {
 }
 
-VehicleCache::VehicleCache(std::shared_ptr<API> api, const std::string& vehicleID) :
-    VariableCache(api, libsumo::CMD_GET_VEHICLE_VARIABLE, vehicleID)
+VehicleCache::VehicleCache(std::shared_ptr<API> api, const std::string& vehicleID, IdInterner::Handle handle) :
+    VariableCache(api, libsumo::CMD_GET_VEHICLE_VARIABLE, vehicleID, handle)
 {
 }
 
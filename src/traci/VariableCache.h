@@ -8,10 +8,15 @@
 #define VARIABLECACHE_H_GJG2APIF
 
 #include "traci/API.h"
+#include "traci/IdInterner.h"
+#include "traci/SubscriptionDecoder.h"
 #include "traci/ValueUtils.h"
 #include "traci/VariableTraits.h"
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 
 namespace traci
 {
@@ -22,7 +27,13 @@ public:
     const std::string& getId() const { return m_id; }
 
     /**
-     * Get value from cache as shared pointer.
+     * Get interned handle of cached object
+     * \return handle or IdInterner::invalid if cache has not been registered by a SubscriptionManager
+     */
+    IdInterner::Handle getHandle() const { return m_handle; }
+
+    /**
+     * Get copy of value from cache as shared pointer.
      * If variable is not present yet, it is automatically retrieved.
      *
      * \param VAR variable identifier
@@ -31,17 +42,8 @@ public:
     template<int VAR>
     std::shared_ptr<const typename VariableTrait<VAR>::result_type> getPtr()
     {
-        using value_type = typename VariableTrait<VAR>::value_type;
         using result_type = typename VariableTrait<VAR>::result_type;
-
-        auto found = m_values.find(VAR);
-        if (found == m_values.end()) {
-            value_type value = retrieve<value_type>(VAR);
-            auto result = std::make_shared<result_type>(make_value(std::move(value)));
-            std::tie(found, std::ignore) = m_values.emplace(VAR, std::move(result));
-        }
-
-        return std::dynamic_pointer_cast<result_type>(found->second);
+        return std::make_shared<const result_type>(make_value(this->get<VAR>()));
     }
 
     /**
@@ -57,7 +59,59 @@ public:
     typename get_value_trait<typename VariableTrait<VAR>::value_type>::return_type
     {
         using value_type = typename VariableTrait<VAR>::value_type;
-        return get_value<value_type>(this->getPtr<VAR>());
+        constexpr int slot = variable_slot(VAR);
+        static_assert(slot >= 0, "variable has no slot in VariableCache");
+
+        auto& value = std::get<slot>(m_slots);
+        if (!(m_valid & slot_mask(slot))) {
+            value = retrieve<value_type>(VAR);
+            m_valid |= slot_mask(slot);
+        }
+        return value;
+    }
+
+    /**
+     * Get writable slot of a variable, the slot is marked as valid
+     *
+     * \param var variable identifier
+     * \return pointer to slot or nullptr if variable has no slot of type T
+     */
+    template<typename T>
+    T* store(int var)
+    {
+        const int slot = variable_slot(var);
+        T* ptr = slot >= 0 ? slot_ptr<T>(m_slots, slot) : nullptr;
+        if (ptr) {
+            m_valid |= slot_mask(slot);
+        }
+        return ptr;
+    }
+
+    /**
+     * Get writable staging slot of a variable, the staging slot is marked as valid
+     *
+     * Staged values are not accessible by get() until they are committed.
+     * \param var variable identifier
+     * \return pointer to staging slot or nullptr if variable has no slot of type T
+     */
+    template<typename T>
+    T* stage(int var)
+    {
+        const int slot = variable_slot(var);
+        T* ptr = slot >= 0 ? slot_ptr<T>(m_staged_slots, slot) : nullptr;
+        if (ptr) {
+            m_staged_valid |= slot_mask(slot);
+        }
+        return ptr;
+    }
+
+    /**
+     * Check if variable is present in cache, i.e. it will not be retrieved on access
+     */
+    bool contains(int var) const
+    {
+        const int slot = variable_slot(var);
+        return slot >= 0 && (m_valid & slot_mask(slot));
     }
 
     /**
@@ -66,29 +120,96 @@ public:
      */
     void reset(const libsumo::TraCIResults& values);
 
+    /**
+     * Reset cache by taking over given values, i.e. buffers are moved instead of copied
+     * \param values new values to be stored
+     */
+    void reset(libsumo::TraCIResults&& values);
+
+    /**
+     * Drop all values but keep slot buffers for reuse
+     */
+    void invalidate() { m_valid = 0; }
+
+    /**
+     * Drop all staged values but keep staging buffers for reuse
+     */
+    void invalidateStaged() { m_staged_valid = 0; }
+
+    /**
+     * Check if any value has been staged since last commit or invalidation
+     */
+    bool hasStaged() const { return m_staged_valid != 0; }
+
+    /**
+     * Replace current values by staged values, buffers are swapped instead of copied
+     *
+     * Values of StaticVariables are kept unless they have been staged again.
+     */
+    void commitStaged();
+
+    /**
+     * Get storage for SubscriptionDecoder, i.e. this cache's slots
+     */
+    SubscriptionDecoder::Results getDecoderResults();
+
 protected:
-    VariableCache(std::shared_ptr<API> api, int command, const std::string& id);
+    VariableCache(std::shared_ptr<API> api, int command, const std::string& id, IdInterner::Handle handle = IdInterner::invalid);
 
     template<typename T>
     T retrieve(int var);
 
 private:
+    using Slots = VariableSlots::storage_type;
+    using SlotMask = std::uint32_t;
+    static_assert(VariableSlots::size <= sizeof(SlotMask) * 8, "slot mask is too small for slot layout");
+
+    static constexpr SlotMask slot_mask(int slot) { return SlotMask(1) << slot; }
+
+    template<typename T, std::size_t I = 0>
+    static T* slot_ptr(Slots& slots, int slot)
+    {
+        if constexpr (I < std::tuple_size<Slots>::value) {
+            if (slot == static_cast<int>(I)) {
+                if constexpr (std::is_same<std::tuple_element_t<I, Slots>, T>::value) {
+                    return &std::get<I>(slots);
+                } else {
+                    return nullptr;
+                }
+            }
+            return slot_ptr<T, I + 1>(slots, slot);
+        } else {
+            return nullptr;
+        }
+    }
+
+    template<typename RESULT>
+    void assign(int var, RESULT& result);
+
+    template<int... VARS>
+    void keepStatic(SlotMask previous, std::integer_sequence<int, VARS...>);
+
     std::shared_ptr<API> m_api;
     const std::string m_id;
-    libsumo::TraCIResults m_values;
+    const IdInterner::Handle m_handle;
+    Slots m_slots;
+    SlotMask m_valid = 0;
+    // staging buffers are written by decoding of simulation steps, possibly in the background
+    Slots m_staged_slots;
+    SlotMask m_staged_valid = 0;
 };
 
 class PersonCache : public VariableCache
 {
 public:
-    PersonCache(std::shared_ptr<API> api, const std::string& personID);
+    PersonCache(std::shared_ptr<API> api, const std::string& personID, IdInterner::Handle handle = IdInterner::invalid);
     const std::string& getPersonId() const { return getId(); }
 };
 
 class VehicleCache : public VariableCache
 {
 public:
-    VehicleCache(std::shared_ptr<API> api, const std::string& vehicleID);
+    VehicleCache(std::shared_ptr<API> api, const std::string& vehicleID, IdInterner::Handle handle = IdInterner::invalid);
     const std::string& getVehicleId() const { return getId(); }
 };
 
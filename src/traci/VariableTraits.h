@@ -8,6 +8,13 @@
 #define VARIABLETRAITS_H_LZ4RYGAV
 
 #include "traci/sumo/libsumo/TraCIConstants.h"
+#include "traci/sumo/libsumo/TraCIDefs.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace traci
 {
@@ -46,6 +53,7 @@ VAR_TRAIT(libsumo::VAR_VEHICLECLASS, std::string)
 VAR_TRAIT(libsumo::VAR_VEHICLE, std::string)
 VAR_TRAIT(libsumo::VAR_LENGTH, double)
 VAR_TRAIT(libsumo::VAR_WIDTH, double)
+VAR_TRAIT(libsumo::VAR_HEIGHT, double)
 VAR_TRAIT(libsumo::VAR_ARRIVED_VEHICLES_IDS, std::vector<std::string>)
 VAR_TRAIT(libsumo::VAR_DEPARTED_VEHICLES_IDS, std::vector<std::string>)
 VAR_TRAIT(libsumo::VAR_DELTA_T, double)
@@ -57,6 +65,81 @@ VAR_TRAIT(libsumo::VAR_ARRIVED_PERSONS_IDS, std::vector<std::string>)
 VAR_TRAIT(libsumo::VAR_DEPARTED_PERSONS_IDS, std::vector<std::string>)
 #undef VAR_TRAIT
 
+
+/**
+ * Variables stored in fixed slots by VariableCache
+ *
+ * Each listed variable requires a VariableTrait, its slot is its position in this list.
+ */
+using SlotVariables = std::integer_sequence<int,
+    libsumo::VAR_SPEED,
+    libsumo::VAR_POSITION,
+    libsumo::VAR_ANGLE,
+    libsumo::VAR_MAXSPEED,
+    libsumo::VAR_TYPE,
+    libsumo::VAR_VEHICLECLASS,
+    libsumo::VAR_VEHICLE,
+    libsumo::VAR_LENGTH,
+    libsumo::VAR_WIDTH,
+    libsumo::VAR_HEIGHT,
+    libsumo::VAR_SIGNALS,
+    libsumo::VAR_ARRIVED_VEHICLES_IDS,
+    libsumo::VAR_DEPARTED_VEHICLES_IDS,
+    libsumo::VAR_TELEPORT_STARTING_VEHICLES_IDS,
+    libsumo::VAR_ARRIVED_PERSONS_IDS,
+    libsumo::VAR_DEPARTED_PERSONS_IDS,
+    libsumo::VAR_DELTA_T,
+    libsumo::VAR_TIME,
+    libsumo::VAR_TIME_STEP
+>;
+
+// lookup table: variable identifier -> slot (-1 if variable has no slot)
+template<int... VARS>
+constexpr std::array<std::int8_t, 256> make_slot_table(std::integer_sequence<int, VARS...>)
+{
+    std::array<std::int8_t, 256> slots {};
+    for (auto& slot : slots) {
+        slot = -1;
+    }
+    std::int8_t slot = 0;
+    ((slots[VARS] = slot++), ...);
+    return slots;
+}
+
+template<typename SEQ>
+struct SlotLayout;
+
+template<int... VARS>
+struct SlotLayout<std::integer_sequence<int, VARS...>>
+{
+    using storage_type = std::tuple<typename VariableTrait<VARS>::value_type...>;
+    static constexpr std::size_t size = sizeof...(VARS);
+    static constexpr std::array<std::int8_t, 256> slots = make_slot_table(std::integer_sequence<int, VARS...> {});
+};
+
+using VariableSlots = SlotLayout<SlotVariables>;
+
+/**
+ * Variables constant during an object's lifetime, e.g. vehicle dimensions
+ *
+ * VariableCache keeps their values across simulation steps once they have been stored or retrieved.
+ * Each listed variable requires a slot.
+ */
+using StaticVariables = std::integer_sequence<int,
+    libsumo::VAR_LENGTH,
+    libsumo::VAR_WIDTH,
+    libsumo::VAR_HEIGHT
+>;
+
+/**
+ * Look up slot of a variable
+ * \return slot index or -1 if variable has no slot
+ */
+constexpr int variable_slot(int var)
+{
+    return var >= 0 && var < 256 ? VariableSlots::slots[var] : -1;
+}
+
 } // namespace traci
 
 #endif /* VARIABLETRAITS_H_LZ4RYGAV */
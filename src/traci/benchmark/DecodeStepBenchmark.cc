@@ -0,0 +1,192 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+/**
+ * Replay the simulation step responses of a recorded TraCI trace and measure their decoding.
+ *
+ * Each step response is decoded by TraCIAPI via tcpip::Storage into its scope results as well as
+ * by SubscriptionDecoder into per-vehicle VariableCache slots, like BasicSubscriptionManager does.
+ * Traces are recorded by a simulation run connected to SUMO with traci.core.traceFile set.
+ *
+ * Usage: traci_decode_benchmark <trace file> [repetitions]
+ */
+
+#include "traci/TraceFile.h"
+#include "traci/VariableCache.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * Skip status response to simulation step command
+ * \return offset of subscription responses
+ */
+std::size_t skipStatus(const traci::TraceReader::Response& response)
+{
+    if (response.length < 1) {
+        throw std::runtime_error("empty step response");
+    }
+    std::size_t length = response.data[0];
+    if (length == 0 && response.length >= 5) {
+        const unsigned char* data = response.data + 1;
+        length = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+    }
+    if (length == 0 || length > response.length) {
+        throw std::runtime_error("malformed status of step response");
+    }
+    return length;
+}
+
+/**
+ * TraCIAPI decoding step responses like TraCIAPI::simulationStep but from a recorded buffer
+ */
+class StorageDecoder : public TraCIAPI
+{
+public:
+    int decode(const unsigned char* data, std::size_t length)
+    {
+        tcpip::Storage inMsg(data, static_cast<int>(length));
+        for (auto& domain : myDomains) {
+            domain.second->clearSubscriptionResults();
+        }
+        int numSubs = inMsg.readInt();
+        const int responses = numSubs;
+        while (numSubs > 0) {
+            int cmdId = check_commandGetResult(inMsg, 0, -1, true);
+            if (cmdId >= libsumo::RESPONSE_SUBSCRIBE_INDUCTIONLOOP_VARIABLE && cmdId <= libsumo::RESPONSE_SUBSCRIBE_PERSON_VARIABLE) {
+                readVariableSubscription(cmdId, inMsg);
+            } else {
+                readContextSubscription(cmdId + 0x50, inMsg);
+            }
+            --numSubs;
+        }
+        return responses;
+    }
+};
+
+/**
+ * Decoder target keeping a VariableCache per vehicle across steps like BasicSubscriptionManager
+ */
+class CacheTarget : public traci::SubscriptionDecoder::Target
+{
+public:
+    CacheTarget() : m_api(std::make_shared<traci::API>()) {}
+
+    void commitDecoding() override
+    {
+        for (auto& vehicle : m_vehicles) {
+            vehicle.second.commitStaged();
+        }
+    }
+
+    traci::SubscriptionDecoder::Results getVariableResults(int response, const std::string& id) override
+    {
+        traci::SubscriptionDecoder::Results results;
+        if (response == libsumo::RESPONSE_SUBSCRIBE_VEHICLE_VARIABLE) {
+            auto found = m_vehicles.find(id);
+            if (found == m_vehicles.end()) {
+                found = m_vehicles.emplace(std::piecewise_construct, std::forward_as_tuple(id),
+                    std::forward_as_tuple(m_api, id)).first;
+            }
+            results.cache = &found->second;
+        } else {
+            results.values = &m_values[id];
+        }
+        return results;
+    }
+
+    traci::SubscriptionDecoder::Results getContextResults(int, const std::string&, const std::string& id) override
+    {
+        traci::SubscriptionDecoder::Results results;
+        results.values = &m_values[id];
+        return results;
+    }
+
+    std::size_t vehicles() const { return m_vehicles.size(); }
+
+private:
+    std::shared_ptr<traci::API> m_api;
+    std::unordered_map<std::string, traci::VehicleCache> m_vehicles;
+    libsumo::SubscriptionResults m_values;
+};
+
+double milliseconds(clock_type::duration duration)
+{
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+} // namespace
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <trace file> [repetitions]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const int repetitions = argc > 2 ? std::atoi(argv[2]) : 10;
+
+    try {
+        const traci::TraceReader trace(argv[1]);
+        if (trace.steps() == 0) {
+            std::cerr << "trace contains no simulation steps" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < trace.steps(); ++i) {
+            bytes += trace.step(i).length;
+        }
+
+        StorageDecoder storage;
+        clock_type::duration storageTime {};
+        for (int rep = 0; rep < repetitions; ++rep) {
+            for (std::size_t i = 0; i < trace.steps(); ++i) {
+                const auto& response = trace.step(i);
+                const std::size_t offset = skipStatus(response);
+                const auto start = clock_type::now();
+                storage.decode(response.data + offset, response.length - offset);
+                storageTime += clock_type::now() - start;
+            }
+        }
+
+        traci::SubscriptionDecoder decoder;
+        CacheTarget target;
+        clock_type::duration decoderTime {};
+        for (int rep = 0; rep < repetitions; ++rep) {
+            for (std::size_t i = 0; i < trace.steps(); ++i) {
+                const auto& response = trace.step(i);
+                const std::size_t offset = skipStatus(response);
+                const auto start = clock_type::now();
+                target.prepareDecoding();
+                decoder.decodeStep(response.data + offset, response.length - offset, target);
+                target.commitDecoding();
+                decoderTime += clock_type::now() - start;
+            }
+        }
+
+        const double steps = static_cast<double>(trace.steps()) * repetitions;
+        std::cout << trace.steps() << " steps, " << std::fixed << std::setprecision(1)
+            << bytes / 1024.0 / trace.steps() << " KiB per step, " << target.vehicles() << " vehicles\n"
+            << std::setprecision(3)
+            << std::setw(20) << "TraCIAPI: " << milliseconds(storageTime) / steps << " ms per step\n"
+            << std::setw(20) << "SubscriptionDecoder: " << milliseconds(decoderTime) / steps << " ms per step, speedup "
+            << std::setprecision(2) << milliseconds(storageTime) / milliseconds(decoderTime) << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "replay failed: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
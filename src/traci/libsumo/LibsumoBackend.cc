@@ -0,0 +1,423 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/libsumo/LibsumoBackend.h"
+#include "traci/libsumo/LibsumoBridge.h"
+#include "traci/VariableCache.h"
+#include "traci/sumo/libsumo/TraCIConstants.h"
+#include <memory>
+#include <variant>
+
+namespace traci
+{
+
+namespace
+{
+
+using Value = LibsumoBridge::Value;
+using Values = LibsumoBridge::Values;
+
+/**
+ * Invoke bridge and report its failures like TraCIAPI does
+ */
+template<typename F>
+auto call(F&& f) -> decltype(f())
+{
+    try {
+        return f();
+    } catch (LibsumoBridge::Error& e) {
+        throw libsumo::TraCIException(e.what());
+    }
+}
+
+/**
+ * Parse a TraCI-encoded value, compound values are flattened
+ */
+void parseValue(tcpip::Storage& in, Values& values)
+{
+    const int type = in.readUnsignedByte();
+    switch (type) {
+        case libsumo::TYPE_COMPOUND: {
+            const int count = in.readInt();
+            for (int i = 0; i < count; ++i) {
+                parseValue(in, values);
+            }
+            break;
+        }
+        case libsumo::TYPE_UBYTE:
+            values.emplace_back(in.readUnsignedByte());
+            break;
+        case libsumo::TYPE_BYTE:
+            values.emplace_back(in.readByte());
+            break;
+        case libsumo::TYPE_INTEGER:
+            values.emplace_back(in.readInt());
+            break;
+        case libsumo::TYPE_DOUBLE:
+            values.emplace_back(in.readDouble());
+            break;
+        case libsumo::TYPE_STRING:
+            values.emplace_back(in.readString());
+            break;
+        case libsumo::TYPE_STRINGLIST:
+            values.emplace_back(in.readStringList());
+            break;
+        case libsumo::TYPE_DOUBLELIST:
+            values.emplace_back(in.readDoubleList());
+            break;
+        case libsumo::TYPE_COLOR: {
+            LibsumoBridge::Color color;
+            color.r = in.readUnsignedByte();
+            color.g = in.readUnsignedByte();
+            color.b = in.readUnsignedByte();
+            color.a = in.readUnsignedByte();
+            values.emplace_back(color);
+            break;
+        }
+        case libsumo::POSITION_2D:
+        case libsumo::POSITION_LON_LAT:
+        case libsumo::POSITION_3D: {
+            LibsumoBridge::Position pos;
+            pos.x = in.readDouble();
+            pos.y = in.readDouble();
+            pos.z = type == libsumo::POSITION_3D ? in.readDouble() : 0.0;
+            values.emplace_back(pos);
+            break;
+        }
+        case libsumo::TYPE_POLYGON: {
+            int size = in.readUnsignedByte();
+            if (size == 0) {
+                size = in.readInt();
+            }
+            std::vector<LibsumoBridge::Position> shape(size);
+            for (LibsumoBridge::Position& pos : shape) {
+                pos.x = in.readDouble();
+                pos.y = in.readDouble();
+            }
+            values.emplace_back(std::move(shape));
+            break;
+        }
+        default:
+            throw libsumo::TraCIException("unsupported parameter type " + std::to_string(type));
+    }
+}
+
+Values parseValues(tcpip::Storage* add)
+{
+    Values values;
+    if (add) {
+        add->resetPos();
+        while (add->valid_pos()) {
+            parseValue(*add, values);
+        }
+    }
+    return values;
+}
+
+template<typename T>
+T expect(Value&& value, int var)
+{
+    if (T* result = std::get_if<T>(&value)) {
+        return std::move(*result);
+    }
+    throw libsumo::TraCIException("unexpected type of variable " + std::to_string(var));
+}
+
+libsumo::TraCIPosition toPosition(const LibsumoBridge::Position& pos)
+{
+    libsumo::TraCIPosition result;
+    result.x = pos.x;
+    result.y = pos.y;
+    result.z = pos.z;
+    return result;
+}
+
+libsumo::TraCIColor toColor(const LibsumoBridge::Color& color)
+{
+    return libsumo::TraCIColor(color.r, color.g, color.b, color.a);
+}
+
+libsumo::TraCIPositionVector toPolygon(const std::vector<LibsumoBridge::Position>& shape)
+{
+    libsumo::TraCIPositionVector result;
+    result.value.reserve(shape.size());
+    for (const LibsumoBridge::Position& pos : shape) {
+        result.value.push_back(toPosition(pos));
+    }
+    return result;
+}
+
+/**
+ * Stores bridged subscription results like SubscriptionDecoder::decodeVariables
+ */
+class ResultsSink : public LibsumoBridge::Sink
+{
+public:
+    explicit ResultsSink(bool staged) : m_staged(staged) {}
+
+    void value(int var, const Value& value) override
+    {
+        std::visit([this, var](const auto& v) { store(var, v); }, value);
+    }
+
+protected:
+    SubscriptionDecoder::Results m_results;
+
+private:
+    template<typename T>
+    T* slot(int var)
+    {
+        if (!m_results.cache) {
+            return nullptr;
+        }
+        return m_staged ? m_results.cache->stage<T>(var) : m_results.cache->store<T>(var);
+    }
+
+    template<typename R>
+    R& emplace(int var)
+    {
+        auto result = std::make_shared<R>();
+        R& ref = *result;
+        (*m_results.values)[var] = std::move(result);
+        return ref;
+    }
+
+    template<typename T, typename R>
+    void assign(int var, const T& value)
+    {
+        if (T* target = slot<T>(var)) {
+            *target = value;
+        } else if (m_results.values) {
+            emplace<R>(var).value = value;
+        }
+    }
+
+    void store(int, const std::monostate&) {}
+    void store(int var, int value) { assign<int, libsumo::TraCIInt>(var, value); }
+    void store(int var, double value) { assign<double, libsumo::TraCIDouble>(var, value); }
+    void store(int var, const std::string& value) { assign<std::string, libsumo::TraCIString>(var, value); }
+    void store(int var, const std::vector<std::string>& value) { assign<std::vector<std::string>, libsumo::TraCIStringList>(var, value); }
+    // vendored TraCI client lacks a double list result
+    void store(int, const std::vector<double>&) {}
+
+    void store(int var, const LibsumoBridge::Position& value)
+    {
+        if (libsumo::TraCIPosition* target = slot<libsumo::TraCIPosition>(var)) {
+            *target = toPosition(value);
+        } else if (m_results.values) {
+            emplace<libsumo::TraCIPosition>(var) = toPosition(value);
+        }
+    }
+
+    void store(int var, const std::vector<LibsumoBridge::Position>& value)
+    {
+        if (m_results.values) {
+            emplace<libsumo::TraCIPositionVector>(var) = toPolygon(value);
+        }
+    }
+
+    void store(int var, const LibsumoBridge::Color& value)
+    {
+        if (m_results.values) {
+            emplace<libsumo::TraCIColor>(var) = toColor(value);
+        }
+    }
+
+    bool m_staged;
+};
+
+/**
+ * Sink storing results by a SubscriptionDecoder's target
+ */
+class TargetSink : public ResultsSink
+{
+public:
+    TargetSink(SubscriptionDecoder::Target& target, bool staged) : ResultsSink(staged), m_target(target) {}
+
+    bool beginVariables(int response, const std::string& id) override
+    {
+        m_results = m_target.getVariableResults(response, id);
+        return m_results.cache || m_results.values;
+    }
+
+    bool beginContext(int response, const std::string& context, const std::string& id) override
+    {
+        m_results = m_target.getContextResults(response, context, id);
+        if (!m_results.cache && !m_results.values) {
+            throw libsumo::TraCIException("no storage for context subscription of " + context);
+        }
+        return true;
+    }
+
+private:
+    SubscriptionDecoder::Target& m_target;
+};
+
+/**
+ * Sink storing results in TraCIAPI's scopes
+ */
+class ScopeSink : public ResultsSink
+{
+public:
+    explicit ScopeSink(std::map<int, TraCIAPI::TraCIScopeWrapper*>& domains) : ResultsSink(false), m_domains(domains) {}
+
+    bool beginVariables(int response, const std::string& id) override
+    {
+        m_results.values = &m_domains.at(response)->getModifiableSubscriptionResults()[id];
+        return true;
+    }
+
+    bool beginContext(int response, const std::string& context, const std::string& id) override
+    {
+        m_results.values = &m_domains.at(response)->getModifiableContextSubscriptionResults(context)[id];
+        return true;
+    }
+
+private:
+    std::map<int, TraCIAPI::TraCIScopeWrapper*>& m_domains;
+};
+
+/**
+ * Sink storing results of a single subscription
+ */
+class SubscriptionSink : public ResultsSink
+{
+public:
+    explicit SubscriptionSink(libsumo::SubscriptionResults& results) : ResultsSink(false), m_subscription_results(results) {}
+
+    bool beginVariables(int, const std::string& id) override
+    {
+        m_results.values = &m_subscription_results[id];
+        return true;
+    }
+
+    bool beginContext(int, const std::string&, const std::string& id) override
+    {
+        m_results.values = &m_subscription_results[id];
+        return true;
+    }
+
+private:
+    libsumo::SubscriptionResults& m_subscription_results;
+};
+
+} // namespace
+
+std::pair<int, std::string> LibsumoBackend::getVersion()
+{
+    return call([] { return LibsumoBridge::getVersion(); });
+}
+
+void LibsumoBackend::close()
+{
+    call([] { LibsumoBridge::close(); });
+}
+
+void LibsumoBackend::simulationStep(double time)
+{
+    call([time] { LibsumoBridge::step(time); });
+}
+
+void LibsumoBackend::readSubscriptions(std::map<int, TraCIAPI::TraCIScopeWrapper*>& domains)
+{
+    ScopeSink sink(domains);
+    call([&sink] { LibsumoBridge::readSubscriptions(sink); });
+}
+
+void LibsumoBackend::readSubscriptions(SubscriptionDecoder::Target& target)
+{
+    TargetSink sink(target, true);
+    call([&sink] { LibsumoBridge::readSubscriptions(sink); });
+}
+
+int LibsumoBackend::getInt(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    return expect<int>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var);
+}
+
+double LibsumoBackend::getDouble(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    Value value = call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); });
+    if (const int* integer = std::get_if<int>(&value)) {
+        return *integer;
+    }
+    return expect<double>(std::move(value), var);
+}
+
+std::string LibsumoBackend::getString(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    return expect<std::string>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var);
+}
+
+std::vector<std::string> LibsumoBackend::getStringVector(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    return expect<std::vector<std::string>>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var);
+}
+
+libsumo::TraCIPosition LibsumoBackend::getPosition(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    return toPosition(expect<LibsumoBridge::Position>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var));
+}
+
+libsumo::TraCIPositionVector LibsumoBackend::getPolygon(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    using Shape = std::vector<LibsumoBridge::Position>;
+    return toPolygon(expect<Shape>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var));
+}
+
+libsumo::TraCIColor LibsumoBackend::getColor(int cmd, int var, const std::string& id, tcpip::Storage* add)
+{
+    return toColor(expect<LibsumoBridge::Color>(call([&] { return LibsumoBridge::get(cmd, var, id, parseValues(add)); }), var));
+}
+
+libsumo::TraCIPosition LibsumoBackend::convertGeo(double x, double y, bool fromGeo)
+{
+    return toPosition(call([&] { return LibsumoBridge::convertGeo(x, y, fromGeo); }));
+}
+
+void LibsumoBackend::set(tcpip::Storage& command)
+{
+    // command layout of TraCIAPI::createCommand
+    command.resetPos();
+    if (command.readUnsignedByte() == 0) {
+        command.readInt();
+    }
+    const int cmd = command.readUnsignedByte();
+    const int var = command.readUnsignedByte();
+    const std::string id = command.readString();
+    Values params;
+    while (command.valid_pos()) {
+        parseValue(command, params);
+    }
+    call([&] { LibsumoBridge::set(cmd, var, id, params); });
+}
+
+void LibsumoBackend::subscribe(int cmd, const std::string& id, const std::vector<int>& vars, double beginTime, double endTime,
+        libsumo::SubscriptionResults& into)
+{
+    SubscriptionSink sink(into);
+    call([&] { LibsumoBridge::subscribe(cmd, id, vars, beginTime, endTime, sink); });
+}
+
+void LibsumoBackend::subscribeContext(int cmd, const std::string& id, int domain, double range, const std::vector<int>& vars,
+        double beginTime, double endTime, libsumo::SubscriptionResults& into)
+{
+    SubscriptionSink sink(into);
+    call([&] { LibsumoBridge::subscribeContext(cmd, id, domain, range, vars, beginTime, endTime, sink); });
+}
+
+void LibsumoBackend::subscribeObjects(int command, const std::vector<std::string>& ids, const std::vector<int>& vars,
+        SubscriptionDecoder::Target& target)
+{
+    TargetSink sink(target, false);
+    call([&] {
+        for (const std::string& id : ids) {
+            LibsumoBridge::subscribe(command, id, vars, libsumo::INVALID_DOUBLE_VALUE, libsumo::INVALID_DOUBLE_VALUE, sink);
+        }
+    });
+}
+
+} // namespace traci
@@ -0,0 +1,55 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef LIBSUMOBACKEND_H_W7PZ3KQE
+#define LIBSUMOBACKEND_H_W7PZ3KQE
+
+#include "traci/InProcessBackend.h"
+
+namespace traci
+{
+
+/**
+ * LibsumoBackend serves traci::API by calling libsumo within the simulation process.
+ *
+ * Requests are neither encoded as TraCI messages nor passed through any socket: getters, setters and
+ * subscriptions are mapped onto libsumo's C++ functions by LibsumoBridge. Subscription results are stored
+ * directly in the subscription target's cache slots.
+ * Parameters of getters and setters are still handed over in TraCI encoding because TraCIAPI's scopes
+ * build them this way. Scope methods bypassing TraCIScopeWrapper's typed getters are not supported.
+ */
+class LibsumoBackend : public InProcessBackend
+{
+public:
+    std::pair<int, std::string> getVersion() override;
+    void close() override;
+
+    void simulationStep(double time) override;
+    void readSubscriptions(std::map<int, TraCIAPI::TraCIScopeWrapper*>& domains) override;
+    void readSubscriptions(SubscriptionDecoder::Target&) override;
+
+    int getInt(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    double getDouble(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    std::string getString(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    std::vector<std::string> getStringVector(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    libsumo::TraCIPosition getPosition(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    libsumo::TraCIPositionVector getPolygon(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    libsumo::TraCIColor getColor(int cmd, int var, const std::string& id, tcpip::Storage* add) override;
+    libsumo::TraCIPosition convertGeo(double x, double y, bool fromGeo) override;
+
+    void set(tcpip::Storage& command) override;
+
+    void subscribe(int cmd, const std::string& id, const std::vector<int>& vars, double beginTime, double endTime,
+            libsumo::SubscriptionResults& into) override;
+    void subscribeContext(int cmd, const std::string& id, int domain, double range, const std::vector<int>& vars,
+            double beginTime, double endTime, libsumo::SubscriptionResults& into) override;
+    void subscribeObjects(int command, const std::vector<std::string>& ids, const std::vector<int>& vars,
+            SubscriptionDecoder::Target&) override;
+};
+
+} // namespace traci
+
+#endif /* LIBSUMOBACKEND_H_W7PZ3KQE */
@@ -0,0 +1,605 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "LibsumoBridge.h"
+#include <libsumo/Edge.h>
+#include <libsumo/Junction.h>
+#include <libsumo/Lane.h>
+#include <libsumo/POI.h>
+#include <libsumo/Person.h>
+#include <libsumo/Polygon.h>
+#include <libsumo/Route.h>
+#include <libsumo/Simulation.h>
+#include <libsumo/TraCIConstants.h>
+#include <libsumo/TraCIDefs.h>
+#include <libsumo/TrafficLight.h>
+#include <libsumo/Vehicle.h>
+#include <libsumo/VehicleType.h>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+namespace traci
+{
+
+namespace
+{
+
+using Value = LibsumoBridge::Value;
+using Values = LibsumoBridge::Values;
+using Error = LibsumoBridge::Error;
+
+// command offsets relative to a domain's get command, e.g. CMD_GET_VEHICLE_VARIABLE
+constexpr int setOffset = libsumo::CMD_SET_VEHICLE_VARIABLE - libsumo::CMD_GET_VEHICLE_VARIABLE;
+constexpr int subscribeOffset = libsumo::CMD_SUBSCRIBE_VEHICLE_VARIABLE - libsumo::CMD_GET_VEHICLE_VARIABLE;
+constexpr int contextOffset = libsumo::CMD_SUBSCRIBE_VEHICLE_CONTEXT - libsumo::CMD_GET_VEHICLE_VARIABLE;
+constexpr int responseOffset = libsumo::RESPONSE_SUBSCRIBE_VEHICLE_VARIABLE - libsumo::CMD_GET_VEHICLE_VARIABLE;
+
+/**
+ * Translate any exception thrown by libsumo into LibsumoBridge::Error
+ */
+template<typename F>
+auto guard(F&& f) -> decltype(f())
+{
+    try {
+        return f();
+    } catch (Error&) {
+        throw;
+    } catch (std::exception& e) {
+        throw Error(e.what());
+    }
+}
+
+Value convert(int value) { return value; }
+Value convert(double value) { return value; }
+Value convert(const std::string& value) { return value; }
+Value convert(const std::vector<std::string>& values) { return values; }
+Value convert(const std::vector<double>& values) { return values; }
+
+Value convert(const libsumo::TraCIPosition& pos)
+{
+    return LibsumoBridge::Position { pos.x, pos.y, pos.z };
+}
+
+Value convert(const libsumo::TraCIPositionVector& shape)
+{
+    std::vector<LibsumoBridge::Position> positions;
+    positions.reserve(shape.value.size());
+    for (const libsumo::TraCIPosition& pos : shape.value) {
+        positions.push_back(LibsumoBridge::Position { pos.x, pos.y, pos.z });
+    }
+    return positions;
+}
+
+Value convert(const libsumo::TraCIColor& color)
+{
+    return LibsumoBridge::Color { color.r, color.g, color.b, color.a };
+}
+
+Value convert(const libsumo::TraCIResult& result)
+{
+    if (auto value = dynamic_cast<const libsumo::TraCIDouble*>(&result)) {
+        return value->value;
+    } else if (auto value = dynamic_cast<const libsumo::TraCIInt*>(&result)) {
+        return value->value;
+    } else if (auto value = dynamic_cast<const libsumo::TraCIString*>(&result)) {
+        return value->value;
+    } else if (auto value = dynamic_cast<const libsumo::TraCIStringList*>(&result)) {
+        return value->value;
+    } else if (auto value = dynamic_cast<const libsumo::TraCIDoubleList*>(&result)) {
+        return value->value;
+    } else if (auto value = dynamic_cast<const libsumo::TraCIPosition*>(&result)) {
+        return convert(*value);
+    } else if (auto value = dynamic_cast<const libsumo::TraCIColor*>(&result)) {
+        return convert(*value);
+    } else if (auto value = dynamic_cast<const libsumo::TraCIPositionVector*>(&result)) {
+        return convert(*value);
+    } else {
+        throw Error("unsupported subscription result: " + result.getString());
+    }
+}
+
+/**
+ * Parameter of a setter or getter, converts implicitly to the parameter type of a libsumo function
+ */
+class Arg
+{
+public:
+    Arg(const Values& params, std::size_t index) : m_value(index < params.size() ? &params[index] : nullptr)
+    {
+        if (!m_value) {
+            throw Error("missing parameter " + std::to_string(index));
+        }
+    }
+
+    operator double() const
+    {
+        if (auto value = std::get_if<int>(m_value)) {
+            return *value;
+        }
+        return get<double>();
+    }
+
+    operator int() const { return get<int>(); }
+    operator bool() const { return get<int>() != 0; }
+    operator std::string() const { return get<std::string>(); }
+    operator std::vector<std::string>() const { return get<std::vector<std::string>>(); }
+
+    operator libsumo::TraCIColor() const
+    {
+        const auto& color = get<LibsumoBridge::Color>();
+        return libsumo::TraCIColor(color.r, color.g, color.b, color.a);
+    }
+
+    operator libsumo::TraCIPositionVector() const
+    {
+        libsumo::TraCIPositionVector shape;
+        for (const LibsumoBridge::Position& pos : get<std::vector<LibsumoBridge::Position>>()) {
+            libsumo::TraCIPosition point;
+            point.x = pos.x;
+            point.y = pos.y;
+            point.z = pos.z;
+            shape.value.push_back(point);
+        }
+        return shape;
+    }
+
+private:
+    template<typename T>
+    const T& get() const
+    {
+        if (auto value = std::get_if<T>(m_value)) {
+            return *value;
+        }
+        throw Error("unexpected parameter type");
+    }
+
+    const Value* m_value;
+};
+
+using Getter = std::function<Value(const std::string&, const Values&)>;
+using Setter = std::function<void(const std::string&, const Values&)>;
+
+/**
+ * Subscription functions of a libsumo domain
+ */
+struct Domain
+{
+    int command; /*< get command */
+    void (*subscribe)(const std::string&, const std::vector<int>&, double, double);
+    void (*unsubscribe)(const std::string&);
+    void (*subscribeContext)(const std::string&, int, double, const std::vector<int>&, double, double);
+    void (*unsubscribeContext)(const std::string&, int, double);
+    libsumo::TraCIResults (*getSubscriptionResults)(const std::string&);
+    libsumo::SubscriptionResults (*getContextSubscriptionResults)(const std::string&);
+    libsumo::SubscriptionResults (*getAllSubscriptionResults)();
+    libsumo::ContextSubscriptionResults (*getAllContextSubscriptionResults)();
+};
+
+/**
+ * Lookup tables of supported libsumo functions indexed by TraCI command and variable
+ */
+class Registry
+{
+public:
+    static const Registry& instance()
+    {
+        static const Registry registry;
+        return registry;
+    }
+
+    const Getter* getter(int command, int variable) const
+    {
+        auto found = m_getters.find(key(command, variable));
+        return found != m_getters.end() ? &found->second : nullptr;
+    }
+
+    const Setter* setter(int command, int variable) const
+    {
+        auto found = m_setters.find(key(command, variable));
+        return found != m_setters.end() ? &found->second : nullptr;
+    }
+
+    const Domain& domain(int command) const
+    {
+        for (const Domain& domain : m_domains) {
+            if (domain.command == command) {
+                return domain;
+            }
+        }
+        throw Error("unsupported TraCI domain " + std::to_string(command));
+    }
+
+    const std::vector<Domain>& domains() const { return m_domains; }
+
+private:
+    Registry();
+
+    static int key(int command, int variable) { return command << 8 | variable; }
+
+    template<typename R>
+    void get(int command, int variable, R (*fn)(const std::string&))
+    {
+        m_getters[key(command, variable)] = [fn](const std::string& id, const Values&) { return convert(fn(id)); };
+    }
+
+    template<typename R>
+    void get(int command, int variable, R (*fn)())
+    {
+        m_getters[key(command, variable)] = [fn](const std::string&, const Values&) { return convert(fn()); };
+    }
+
+    void get(int command, int variable, Getter fn)
+    {
+        m_getters[key(command, variable)] = std::move(fn);
+    }
+
+    template<typename A>
+    void set(int command, int variable, void (*fn)(const std::string&, A))
+    {
+        m_setters[key(command + setOffset, variable)] = [fn](const std::string& id, const Values& params) { fn(id, Arg(params, 0)); };
+    }
+
+    void set(int command, int variable, Setter fn)
+    {
+        m_setters[key(command + setOffset, variable)] = std::move(fn);
+    }
+
+    /**
+     * Register identifiers, generic parameters and subscriptions of a libsumo domain
+     */
+    template<typename D>
+    void registerDomain(int command)
+    {
+        get(command, libsumo::TRACI_ID_LIST, &D::getIDList);
+        get(command, libsumo::ID_COUNT, &D::getIDCount);
+        get(command, libsumo::VAR_PARAMETER, [](const std::string& id, const Values& params) -> Value {
+            return D::getParameter(id, Arg(params, 0));
+        });
+        set(command, libsumo::VAR_PARAMETER, [](const std::string& id, const Values& params) {
+            D::setParameter(id, Arg(params, 0), Arg(params, 1));
+        });
+        subscriptions<D>(command);
+    }
+
+    template<typename D>
+    void subscriptions(int command)
+    {
+        Domain entry;
+        entry.command = command;
+        entry.subscribe = [](const std::string& id, const std::vector<int>& vars, double begin, double end) {
+            D::subscribe(id, vars, begin, end);
+        };
+        entry.unsubscribe = [](const std::string& id) { D::unsubscribe(id); };
+        entry.subscribeContext = [](const std::string& id, int context, double range, const std::vector<int>& vars, double begin, double end) {
+            D::subscribeContext(id, context, range, vars, begin, end);
+        };
+        entry.unsubscribeContext = [](const std::string& id, int context, double range) { D::unsubscribeContext(id, context, range); };
+        entry.getSubscriptionResults = [](const std::string& id) -> libsumo::TraCIResults { return D::getSubscriptionResults(id); };
+        entry.getContextSubscriptionResults = [](const std::string& id) -> libsumo::SubscriptionResults {
+            return D::getContextSubscriptionResults(id);
+        };
+        entry.getAllSubscriptionResults = []() -> libsumo::SubscriptionResults { return D::getAllSubscriptionResults(); };
+        entry.getAllContextSubscriptionResults = []() -> libsumo::ContextSubscriptionResults {
+            return D::getAllContextSubscriptionResults();
+        };
+        m_domains.push_back(entry);
+    }
+
+    std::unordered_map<int, Getter> m_getters;
+    std::unordered_map<int, Setter> m_setters;
+    std::vector<Domain> m_domains;
+};
+
+Registry::Registry()
+{
+    using namespace libsumo;
+
+    {
+        const int cmd = CMD_GET_SIM_VARIABLE;
+        get(cmd, VAR_TIME, &Simulation::getTime);
+        get(cmd, VAR_TIME_STEP, [](const std::string&, const Values&) -> Value {
+            return static_cast<int>(std::lround(Simulation::getTime() * 1000.0));
+        });
+        get(cmd, VAR_DELTA_T, &Simulation::getDeltaT);
+        get(cmd, VAR_MIN_EXPECTED_VEHICLES, &Simulation::getMinExpectedNumber);
+        get(cmd, VAR_NET_BOUNDING_BOX, &Simulation::getNetBoundary);
+        get(cmd, VAR_LOADED_VEHICLES_IDS, &Simulation::getLoadedIDList);
+        get(cmd, VAR_DEPARTED_VEHICLES_IDS, &Simulation::getDepartedIDList);
+        get(cmd, VAR_DEPARTED_VEHICLES_NUMBER, &Simulation::getDepartedNumber);
+        get(cmd, VAR_ARRIVED_VEHICLES_IDS, &Simulation::getArrivedIDList);
+        get(cmd, VAR_ARRIVED_VEHICLES_NUMBER, &Simulation::getArrivedNumber);
+        get(cmd, VAR_TELEPORT_STARTING_VEHICLES_IDS, &Simulation::getStartingTeleportIDList);
+        get(cmd, VAR_DEPARTED_PERSONS_IDS, &Simulation::getDepartedPersonIDList);
+        get(cmd, VAR_ARRIVED_PERSONS_IDS, &Simulation::getArrivedPersonIDList);
+        subscriptions<Simulation>(cmd);
+    }
+
+    {
+        const int cmd = CMD_GET_VEHICLE_VARIABLE;
+        registerDomain<Vehicle>(cmd);
+        get(cmd, VAR_POSITION, [](const std::string& id, const Values&) { return convert(Vehicle::getPosition(id)); });
+        get(cmd, VAR_POSITION3D, &Vehicle::getPosition3D);
+        get(cmd, VAR_ANGLE, &Vehicle::getAngle);
+        get(cmd, VAR_SLOPE, &Vehicle::getSlope);
+        get(cmd, VAR_SPEED, &Vehicle::getSpeed);
+        get(cmd, VAR_ACCELERATION, &Vehicle::getAcceleration);
+        get(cmd, VAR_MAXSPEED, &Vehicle::getMaxSpeed);
+        get(cmd, VAR_SPEED_FACTOR, &Vehicle::getSpeedFactor);
+        get(cmd, VAR_SPEEDSETMODE, &Vehicle::getSpeedMode);
+        get(cmd, VAR_LANECHANGE_MODE, &Vehicle::getLaneChangeMode);
+        get(cmd, VAR_LENGTH, &Vehicle::getLength);
+        get(cmd, VAR_WIDTH, &Vehicle::getWidth);
+        get(cmd, VAR_HEIGHT, &Vehicle::getHeight);
+        get(cmd, VAR_TYPE, &Vehicle::getTypeID);
+        get(cmd, VAR_VEHICLECLASS, &Vehicle::getVehicleClass);
+        get(cmd, VAR_COLOR, &Vehicle::getColor);
+        get(cmd, VAR_SIGNALS, &Vehicle::getSignals);
+        get(cmd, VAR_ROAD_ID, &Vehicle::getRoadID);
+        get(cmd, VAR_LANE_ID, &Vehicle::getLaneID);
+        get(cmd, VAR_LANE_INDEX, &Vehicle::getLaneIndex);
+        get(cmd, VAR_LANEPOSITION, &Vehicle::getLanePosition);
+        get(cmd, VAR_ROUTE_ID, &Vehicle::getRouteID);
+        get(cmd, VAR_EDGES, &Vehicle::getRoute);
+        get(cmd, VAR_DISTANCE, &Vehicle::getDistance);
+        get(cmd, VAR_WAITING_TIME, &Vehicle::getWaitingTime);
+        get(cmd, VAR_STOPSTATE, &Vehicle::getStopState);
+        set(cmd, VAR_SPEED, &Vehicle::setSpeed);
+        set(cmd, VAR_MAXSPEED, &Vehicle::setMaxSpeed);
+        set(cmd, VAR_SPEED_FACTOR, &Vehicle::setSpeedFactor);
+        set(cmd, VAR_SPEEDSETMODE, &Vehicle::setSpeedMode);
+        set(cmd, VAR_LANECHANGE_MODE, &Vehicle::setLaneChangeMode);
+        set(cmd, VAR_LENGTH, &Vehicle::setLength);
+        set(cmd, VAR_WIDTH, &Vehicle::setWidth);
+        set(cmd, VAR_HEIGHT, &Vehicle::setHeight);
+        set(cmd, VAR_TYPE, &Vehicle::setType);
+        set(cmd, VAR_COLOR, &Vehicle::setColor);
+        set(cmd, VAR_ROUTE_ID, &Vehicle::setRouteID);
+        set(cmd, VAR_ROUTE, [](const std::string& id, const Values& params) {
+            const std::vector<std::string>& edges = Arg(params, 0);
+            Vehicle::setRoute(id, edges);
+        });
+        set(cmd, CMD_CHANGETARGET, &Vehicle::changeTarget);
+        set(cmd, CMD_SLOWDOWN, [](const std::string& id, const Values& params) {
+            Vehicle::slowDown(id, Arg(params, 0), Arg(params, 1));
+        });
+        set(cmd, CMD_CHANGELANE, [](const std::string& id, const Values& params) {
+            Vehicle::changeLane(id, Arg(params, 0), Arg(params, 1));
+        });
+    }
+
+    {
+        const int cmd = CMD_GET_PERSON_VARIABLE;
+        registerDomain<Person>(cmd);
+        get(cmd, VAR_POSITION, [](const std::string& id, const Values&) { return convert(Person::getPosition(id)); });
+        get(cmd, VAR_POSITION3D, &Person::getPosition3D);
+        get(cmd, VAR_ANGLE, &Person::getAngle);
+        get(cmd, VAR_SPEED, &Person::getSpeed);
+        get(cmd, VAR_LENGTH, &Person::getLength);
+        get(cmd, VAR_WIDTH, &Person::getWidth);
+        get(cmd, VAR_HEIGHT, &Person::getHeight);
+        get(cmd, VAR_TYPE, &Person::getTypeID);
+        get(cmd, VAR_COLOR, &Person::getColor);
+        get(cmd, VAR_ROAD_ID, &Person::getRoadID);
+        get(cmd, VAR_LANEPOSITION, &Person::getLanePosition);
+        get(cmd, VAR_VEHICLE, &Person::getVehicle);
+        get(cmd, VAR_WAITING_TIME, &Person::getWaitingTime);
+        set(cmd, VAR_SPEED, &Person::setSpeed);
+        set(cmd, VAR_TYPE, &Person::setType);
+        set(cmd, VAR_COLOR, &Person::setColor);
+    }
+
+    {
+        const int cmd = CMD_GET_VEHICLETYPE_VARIABLE;
+        registerDomain<VehicleType>(cmd);
+        get(cmd, VAR_LENGTH, &VehicleType::getLength);
+        get(cmd, VAR_WIDTH, &VehicleType::getWidth);
+        get(cmd, VAR_HEIGHT, &VehicleType::getHeight);
+        get(cmd, VAR_MINGAP, &VehicleType::getMinGap);
+        get(cmd, VAR_MAXSPEED, &VehicleType::getMaxSpeed);
+        get(cmd, VAR_SPEED_FACTOR, &VehicleType::getSpeedFactor);
+        get(cmd, VAR_ACCEL, &VehicleType::getAccel);
+        get(cmd, VAR_DECEL, &VehicleType::getDecel);
+        get(cmd, VAR_EMERGENCY_DECEL, &VehicleType::getEmergencyDecel);
+        get(cmd, VAR_VEHICLECLASS, &VehicleType::getVehicleClass);
+        get(cmd, VAR_COLOR, &VehicleType::getColor);
+        set(cmd, VAR_LENGTH, &VehicleType::setLength);
+        set(cmd, VAR_WIDTH, &VehicleType::setWidth);
+        set(cmd, VAR_HEIGHT, &VehicleType::setHeight);
+        set(cmd, VAR_MAXSPEED, &VehicleType::setMaxSpeed);
+        set(cmd, VAR_ACCEL, &VehicleType::setAccel);
+        set(cmd, VAR_DECEL, &VehicleType::setDecel);
+        set(cmd, VAR_EMERGENCY_DECEL, &VehicleType::setEmergencyDecel);
+        set(cmd, VAR_COLOR, &VehicleType::setColor);
+    }
+
+    {
+        const int cmd = CMD_GET_EDGE_VARIABLE;
+        registerDomain<Edge>(cmd);
+        get(cmd, VAR_CURRENT_TRAVELTIME, &Edge::getTraveltime);
+        get(cmd, VAR_LANE_INDEX, &Edge::getLaneNumber);
+        get(cmd, VAR_NAME, &Edge::getStreetName);
+        get(cmd, LAST_STEP_MEAN_SPEED, &Edge::getLastStepMeanSpeed);
+        get(cmd, LAST_STEP_VEHICLE_NUMBER, &Edge::getLastStepVehicleNumber);
+        get(cmd, LAST_STEP_VEHICLE_ID_LIST, &Edge::getLastStepVehicleIDs);
+        set(cmd, VAR_MAXSPEED, &Edge::setMaxSpeed);
+    }
+
+    {
+        const int cmd = CMD_GET_LANE_VARIABLE;
+        registerDomain<Lane>(cmd);
+        get(cmd, VAR_LENGTH, &Lane::getLength);
+        get(cmd, VAR_MAXSPEED, &Lane::getMaxSpeed);
+        get(cmd, VAR_WIDTH, &Lane::getWidth);
+        get(cmd, LANE_EDGE_ID, &Lane::getEdgeID);
+        get(cmd, VAR_SHAPE, &Lane::getShape);
+        get(cmd, LAST_STEP_MEAN_SPEED, &Lane::getLastStepMeanSpeed);
+        get(cmd, LAST_STEP_VEHICLE_NUMBER, &Lane::getLastStepVehicleNumber);
+        get(cmd, LAST_STEP_VEHICLE_ID_LIST, &Lane::getLastStepVehicleIDs);
+        set(cmd, VAR_MAXSPEED, &Lane::setMaxSpeed);
+    }
+
+    {
+        const int cmd = CMD_GET_ROUTE_VARIABLE;
+        registerDomain<Route>(cmd);
+        get(cmd, VAR_EDGES, &Route::getEdges);
+    }
+
+    {
+        const int cmd = CMD_GET_JUNCTION_VARIABLE;
+        registerDomain<Junction>(cmd);
+        get(cmd, VAR_POSITION, [](const std::string& id, const Values&) { return convert(Junction::getPosition(id)); });
+        get(cmd, VAR_SHAPE, &Junction::getShape);
+    }
+
+    {
+        const int cmd = CMD_GET_POLYGON_VARIABLE;
+        registerDomain<Polygon>(cmd);
+        get(cmd, VAR_TYPE, &Polygon::getType);
+        get(cmd, VAR_SHAPE, &Polygon::getShape);
+        get(cmd, VAR_COLOR, &Polygon::getColor);
+        get(cmd, VAR_FILL, [](const std::string& id, const Values&) { return convert(Polygon::getFilled(id) ? 1 : 0); });
+        set(cmd, VAR_TYPE, &Polygon::setType);
+        set(cmd, VAR_COLOR, &Polygon::setColor);
+        set(cmd, VAR_SHAPE, &Polygon::setShape);
+        set(cmd, VAR_FILL, [](const std::string& id, const Values& params) { Polygon::setFilled(id, Arg(params, 0)); });
+    }
+
+    {
+        const int cmd = CMD_GET_POI_VARIABLE;
+        registerDomain<POI>(cmd);
+        get(cmd, VAR_TYPE, &POI::getType);
+        get(cmd, VAR_COLOR, &POI::getColor);
+        get(cmd, VAR_POSITION, [](const std::string& id, const Values&) { return convert(POI::getPosition(id)); });
+        set(cmd, VAR_TYPE, &POI::setType);
+        set(cmd, VAR_COLOR, &POI::setColor);
+    }
+
+    {
+        const int cmd = CMD_GET_TL_VARIABLE;
+        registerDomain<TrafficLight>(cmd);
+        get(cmd, TL_RED_YELLOW_GREEN_STATE, &TrafficLight::getRedYellowGreenState);
+        get(cmd, TL_CURRENT_PHASE, &TrafficLight::getPhase);
+        get(cmd, TL_CURRENT_PROGRAM, &TrafficLight::getProgram);
+        get(cmd, TL_NEXT_SWITCH, &TrafficLight::getNextSwitch);
+        get(cmd, TL_CONTROLLED_LANES, &TrafficLight::getControlledLanes);
+        set(cmd, TL_RED_YELLOW_GREEN_STATE, &TrafficLight::setRedYellowGreenState);
+        set(cmd, TL_PHASE_INDEX, &TrafficLight::setPhase);
+        set(cmd, TL_PHASE_DURATION, &TrafficLight::setPhaseDuration);
+        set(cmd, TL_PROGRAM, &TrafficLight::setProgram);
+    }
+}
+
+void deliver(const libsumo::TraCIResults& results, LibsumoBridge::Sink& sink)
+{
+    for (const auto& result : results) {
+        sink.value(result.first, convert(*result.second));
+    }
+}
+
+void deliverContext(int response, const std::string& context, const libsumo::SubscriptionResults& objects, LibsumoBridge::Sink& sink)
+{
+    for (const auto& object : objects) {
+        if (sink.beginContext(response, context, object.first)) {
+            deliver(object.second, sink);
+        }
+    }
+}
+
+} // namespace
+
+void LibsumoBridge::load(const std::vector<std::string>& args)
+{
+    guard([&] { libsumo::Simulation::load(args); });
+}
+
+void LibsumoBridge::close()
+{
+    guard([] { libsumo::Simulation::close(); });
+}
+
+std::pair<int, std::string> LibsumoBridge::getVersion()
+{
+    return guard([] { return libsumo::Simulation::getVersion(); });
+}
+
+void LibsumoBridge::step(double time)
+{
+    guard([time] { libsumo::Simulation::step(time); });
+}
+
+LibsumoBridge::Value LibsumoBridge::get(int command, int variable, const std::string& id, const Values& params)
+{
+    const Getter* getter = Registry::instance().getter(command, variable);
+    if (!getter) {
+        throw Error("variable " + std::to_string(variable) + " of domain " + std::to_string(command) + " is not supported by libsumo bridge");
+    }
+    return guard([&] { return (*getter)(id, params); });
+}
+
+void LibsumoBridge::set(int command, int variable, const std::string& id, const Values& params)
+{
+    const Setter* setter = Registry::instance().setter(command, variable);
+    if (!setter) {
+        throw Error("variable " + std::to_string(variable) + " of domain " + std::to_string(command) + " is not settable by libsumo bridge");
+    }
+    guard([&] { (*setter)(id, params); });
+}
+
+void LibsumoBridge::subscribe(int command, const std::string& id, const std::vector<int>& vars, double begin, double end, Sink& sink)
+{
+    const Domain& domain = Registry::instance().domain(command - subscribeOffset);
+    guard([&] {
+        if (vars.empty()) {
+            domain.unsubscribe(id);
+        } else {
+            // libsumo evaluates new subscriptions immediately like a TraCI server
+            domain.subscribe(id, vars, begin, end);
+            if (sink.beginVariables(domain.command + responseOffset, id)) {
+                deliver(domain.getSubscriptionResults(id), sink);
+            }
+        }
+    });
+}
+
+void LibsumoBridge::subscribeContext(int command, const std::string& id, int context, double range, const std::vector<int>& vars,
+        double begin, double end, Sink& sink)
+{
+    const Domain& domain = Registry::instance().domain(command - contextOffset);
+    guard([&] {
+        if (vars.empty()) {
+            domain.unsubscribeContext(id, context, range);
+        } else {
+            domain.subscribeContext(id, context, range, vars, begin, end);
+            deliverContext(domain.command + responseOffset, id, domain.getContextSubscriptionResults(id), sink);
+        }
+    });
+}
+
+void LibsumoBridge::readSubscriptions(Sink& sink)
+{
+    guard([&] {
+        for (const Domain& domain : Registry::instance().domains()) {
+            const int response = domain.command + responseOffset;
+            for (const auto& object : domain.getAllSubscriptionResults()) {
+                if (sink.beginVariables(response, object.first)) {
+                    deliver(object.second, sink);
+                }
+            }
+            for (const auto& context : domain.getAllContextSubscriptionResults()) {
+                deliverContext(response, context.first, context.second, sink);
+            }
+        }
+    });
+}
+
+LibsumoBridge::Position LibsumoBridge::convertGeo(double x, double y, bool fromGeo)
+{
+    const libsumo::TraCIPosition pos = guard([&] { return libsumo::Simulation::convertGeo(x, y, fromGeo); });
+    return Position { pos.x, pos.y, pos.z };
+}
+
+} // namespace traci
@@ -0,0 +1,140 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef LIBSUMOBRIDGE_H_Q2WD8LTN
+#define LIBSUMOBRIDGE_H_Q2WD8LTN
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * LibsumoBridge calls libsumo's C++ API within the simulation process.
+ *
+ * Values are exchanged by neutral types because this header must not depend on libsumo headers:
+ * SUMO's libsumo definitions clash with the vendored TraCI client definitions.
+ * Domains and variables are identified by TraCI constants, e.g. CMD_GET_VEHICLE_VARIABLE and VAR_SPEED.
+ * Any failure is reported by LibsumoBridge::Error.
+ */
+class LibsumoBridge
+{
+public:
+    struct Position
+    {
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+    };
+
+    struct Color
+    {
+        int r = 0;
+        int g = 0;
+        int b = 0;
+        int a = 255;
+    };
+
+    using Value = std::variant<std::monostate, int, double, std::string, std::vector<std::string>, std::vector<double>,
+          Position, std::vector<Position>, Color>;
+    using Values = std::vector<Value>;
+
+    class Error : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * Receiver of subscription results
+     */
+    class Sink
+    {
+    public:
+        virtual ~Sink() = default;
+
+        /**
+         * Begin results of a variable subscription
+         * \param response TraCI response command of domain, e.g. RESPONSE_SUBSCRIBE_VEHICLE_VARIABLE
+         * \param id object identifier
+         * \return false if object's values shall be skipped
+         */
+        virtual bool beginVariables(int response, const std::string& id) = 0;
+
+        /**
+         * Begin results of an object within a context subscription
+         * \param response TraCI response command of variable subscriptions in the context object's domain
+         * \param context identifier of context object
+         * \param id object identifier
+         * \return false if object's values shall be skipped
+         */
+        virtual bool beginContext(int response, const std::string& context, const std::string& id) = 0;
+
+        /**
+         * Value of current object's variable
+         */
+        virtual void value(int variable, const Value&) = 0;
+    };
+
+    /**
+     * Load SUMO simulation within this process
+     * \param args SUMO command line options (without executable name)
+     */
+    static void load(const std::vector<std::string>& args);
+    static void close();
+    static std::pair<int, std::string> getVersion();
+
+    /**
+     * Perform simulation step
+     * \param time target time of simulation step (0 for a single step)
+     */
+    static void step(double time);
+
+    /**
+     * Get a variable's value
+     * \param command TraCI get command identifying the domain
+     * \param params additional parameters of variable, e.g. the key of VAR_PARAMETER
+     */
+    static Value get(int command, int variable, const std::string& id, const Values& params);
+
+    /**
+     * Set a variable's value
+     * \param command TraCI set command identifying the domain
+     * \param params new value, compound values are flattened
+     */
+    static void set(int command, int variable, const std::string& id, const Values& params);
+
+    /**
+     * Subscribe variables of an object and pass initial values to sink
+     * \param command TraCI variable subscription command identifying the domain
+     * \param vars subscribed variables, empty list cancels subscription
+     */
+    static void subscribe(int command, const std::string& id, const std::vector<int>& vars, double begin, double end, Sink&);
+
+    /**
+     * Subscribe variables of objects around an object and pass initial values to sink
+     * \param command TraCI context subscription command identifying the context object's domain
+     * \param domain TraCI get command of subscribed objects' domain
+     * \param vars subscribed variables, empty list cancels subscription
+     */
+    static void subscribeContext(int command, const std::string& id, int domain, double range, const std::vector<int>& vars,
+            double begin, double end, Sink&);
+
+    /**
+     * Pass results of all subscriptions after latest simulation step to sink
+     */
+    static void readSubscriptions(Sink&);
+
+    static Position convertGeo(double x, double y, bool fromGeo);
+};
+
+} // namespace traci
+
+#endif /* LIBSUMOBRIDGE_H_Q2WD8LTN */
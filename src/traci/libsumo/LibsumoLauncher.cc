@@ -0,0 +1,82 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#include "traci/libsumo/LibsumoLauncher.h"
+#include "traci/libsumo/LibsumoBackend.h"
+#include "traci/libsumo/LibsumoBridge.h"
+#include <omnetpp/cconfiguration.h>
+#include <regex>
+#include <sstream>
+
+namespace traci
+{
+
+Define_Module(LibsumoLauncher)
+
+void LibsumoLauncher::initialize()
+{
+    m_command = par("command").stringValue();
+    m_sumocfg = par("sumocfg").stringValue();
+    m_extra_options = par("extraOptions").stringValue();
+    m_load_state = par("loadState").stringValue();
+    m_seed = par("seed");
+}
+
+ServerEndpoint LibsumoLauncher::launch()
+{
+    // workaround: creates <resultdir> before loading SUMO (for logfile output)
+    recordScalar("seed", m_seed);
+
+    try {
+        LibsumoBridge::load(arguments());
+    } catch (std::exception& e) {
+        throw omnetpp::cRuntimeError("Loading SUMO by libsumo failed: %s", e.what());
+    }
+
+    ServerEndpoint endpoint;
+    endpoint.hostname = "libsumo";
+    endpoint.port = 0;
+    endpoint.backend = []() { return std::unique_ptr<InProcessBackend> { new LibsumoBackend() }; };
+    return endpoint;
+}
+
+std::vector<std::string> LibsumoLauncher::arguments() const
+{
+    std::regex sumocfg("%SUMOCFG%");
+    std::regex seed("%SEED%");
+    std::regex run("%RUN%");
+    std::regex resultdir("%RESULTDIR%");
+
+    const auto cfg = getSimulation()->getEnvir()->getConfigEx();
+    const auto cfg_run_number = cfg->getVariable(CFGVAR_RUNNUMBER);
+    const auto cfg_result_dir = cfg->getVariable(CFGVAR_RESULTDIR);
+
+    std::string command = m_command;
+    command = std::regex_replace(command, sumocfg, m_sumocfg);
+    command = std::regex_replace(command, seed, std::to_string(m_seed));
+    command = std::regex_replace(command, run, cfg_run_number);
+    command = std::regex_replace(command, resultdir, cfg_result_dir);
+
+    if (!m_extra_options.empty()) {
+        command.append(1, ' ').append(m_extra_options);
+    }
+
+    // libsumo expects separate arguments, no shell is involved
+    std::vector<std::string> args;
+    std::istringstream tokens(command);
+    std::string token;
+    while (tokens >> token) {
+        args.push_back(token);
+    }
+
+    if (!m_load_state.empty()) {
+        args.push_back("--load-state");
+        args.push_back(m_load_state);
+    }
+    return args;
+}
+
+} // namespace traci
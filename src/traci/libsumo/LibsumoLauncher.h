@@ -0,0 +1,41 @@
+/*
+ * Artery V2X Simulation Framework
+ * Copyright 2026 Artery contributors
+ * Licensed under GPLv2, see COPYING file for detailed license and warranty terms.
+ */
+
+#ifndef LIBSUMOLAUNCHER_H_E5NC1RVA
+#define LIBSUMOLAUNCHER_H_E5NC1RVA
+
+#include "traci/Launcher.h"
+#include <omnetpp/csimplemodule.h>
+#include <string>
+#include <vector>
+
+namespace traci
+{
+
+/**
+ * LibsumoLauncher runs SUMO within the simulation process by libsumo.
+ */
+class LibsumoLauncher : public Launcher, public omnetpp::cSimpleModule
+{
+public:
+    ServerEndpoint launch() override;
+
+protected:
+    void initialize() override;
+
+private:
+    std::vector<std::string> arguments() const;
+
+    std::string m_command;
+    std::string m_sumocfg;
+    std::string m_extra_options;
+    std::string m_load_state;
+    int m_seed;
+};
+
+} // namespace traci
+
+#endif /* LIBSUMOLAUNCHER_H_E5NC1RVA */
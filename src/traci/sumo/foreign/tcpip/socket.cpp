@@ -481,7 +481,7 @@ namespace tcpip
 	// ----------------------------------------------------------------------
 	void
 		Socket::
-		printBufferOnVerbose(const std::vector<unsigned char> buffer, const std::string &label)
+		printBufferOnVerbose(const std::vector<unsigned char>& buffer, const std::string &label)
 		const
 	{
 		if (verbose_)
@@ -526,10 +526,11 @@ namespace tcpip
 		Socket::
 		receiveExact( Storage &msg )
 	{
-		// buffer for received bytes
+		// buffer for received bytes (reused across messages to avoid reallocation)
 		// According to the C++ standard elements of a std::vector are stored
 		// contiguously. Explicitly &buffer[n] == &buffer[0] + n for 0 <= n < buffer.size().
-		std::vector<unsigned char> buffer(lengthLen);
+		std::vector<unsigned char>& buffer = receiveBuffer_;
+		buffer.resize(lengthLen);
 
 		// receive length of TraCI message
 		receiveComplete(&buffer[0], lengthLen);
@@ -68,7 +68,7 @@ namespace tcpip
 		Socket(int port);
 
 		/// Destructor
-		~Socket();
+		virtual ~Socket();
 
 		/// @brief Returns an free port on the system
 		/// @note This is done by binding a socket with port=0, getting the assigned port, and closing the socket again
@@ -81,12 +81,12 @@ namespace tcpip
         Socket* accept(const bool create = false);
 
 		void send( const std::vector<unsigned char> &buffer);
-		void sendExact( const Storage & );
+		virtual void sendExact( const Storage & );
 		/// Receive up to \p bufSize available bytes from Socket::socket_
 		std::vector<unsigned char> receive( int bufSize = 2048 );
 		/// Receive a complete TraCI message from Socket::socket_
-		bool receiveExact( Storage &);
-		void close();
+		virtual bool receiveExact( Storage &);
+		virtual void close();
 		int port();
 		void set_blocking(bool);
 		bool is_blocking();
@@ -105,7 +105,7 @@ namespace tcpip
 		/// Receive up to \p len available bytes from Socket::socket_
 		size_t recvAndCheck(unsigned char * const buffer, std::size_t len) const;
 		/// Print \p label and \p buffer to stderr if Socket::verbose_ is set
-		void printBufferOnVerbose(const std::vector<unsigned char> buffer, const std::string &label) const;
+		void printBufferOnVerbose(const std::vector<unsigned char>& buffer, const std::string &label) const;
 
 	private:
 		void init();
@@ -123,6 +123,9 @@ namespace tcpip
 		bool blocking_;
 
 		bool verbose_;
+
+		/// receive buffer reused by receiveExact
+		std::vector<unsigned char> receiveBuffer_;
 #ifdef WIN32
 		static bool init_windows_sockets_;
 		static bool windows_sockets_initialized_;
@@ -87,6 +87,9 @@ TraCIAPI::connect(const std::string& host, int port) {
 
 void
 TraCIAPI::setOrder(int order) {
+    if (myBackend != nullptr) {
+        return;
+    }
     tcpip::Storage outMsg;
     // command length
     outMsg.writeUnsignedByte(1 + 1 + 4);
@@ -94,6 +97,7 @@ TraCIAPI::setOrder(int order) {
     outMsg.writeUnsignedByte(libsumo::CMD_SETORDER);
     outMsg.writeInt(order);
     // send request message
+    prepareRequest();
     mySocket->sendExact(outMsg);
     tcpip::Storage inMsg;
     check_resultState(inMsg, libsumo::CMD_SETORDER);
@@ -102,6 +106,11 @@ TraCIAPI::setOrder(int order) {
 
 void
 TraCIAPI::close() {
+    if (myBackend != nullptr) {
+        prepareRequest();
+        myBackend->close();
+        return;
+    }
     send_commandClose();
     tcpip::Storage inMsg;
     std::string acknowledgement;
@@ -130,6 +139,7 @@ TraCIAPI::send_commandSimulationStep(double time) const {
     outMsg.writeUnsignedByte(libsumo::CMD_SIMSTEP);
     outMsg.writeDouble(time);
     // send request message
+    prepareRequest();
     mySocket->sendExact(outMsg);
 }
 
@@ -141,6 +151,7 @@ TraCIAPI::send_commandClose() const {
     outMsg.writeUnsignedByte(1 + 1);
     // command id
     outMsg.writeUnsignedByte(libsumo::CMD_CLOSE);
+    prepareRequest();
     mySocket->sendExact(outMsg);
 }
 
@@ -154,6 +165,7 @@ TraCIAPI::send_commandSetOrder(int order) const {
     outMsg.writeUnsignedByte(libsumo::CMD_SETORDER);
     // client index
     outMsg.writeInt(order);
+    prepareRequest();
     mySocket->sendExact(outMsg);
 }
 
@@ -229,6 +241,7 @@ TraCIAPI::send_commandSubscribeObjectVariable(int domID, const std::string& objI
         outMsg.writeUnsignedByte(vars[i]);
     }
     // send message
+    prepareRequest();
     mySocket->sendExact(outMsg);
 }
 
@@ -260,6 +273,7 @@ TraCIAPI::send_commandSubscribeObjectContext(int domID, const std::string& objID
         outMsg.writeUnsignedByte(vars[i]);
     }
     // send message
+    prepareRequest();
     mySocket->sendExact(outMsg);
 }
 
@@ -329,7 +343,11 @@ TraCIAPI::check_commandGetResult(tcpip::Storage& inMsg, int command, int expecte
 
 bool
 TraCIAPI::processGet(int command, int expectedType, bool ignoreCommandId) {
+    if (myBackend != nullptr) {
+        throw libsumo::TraCIException("TraCI request " + std::to_string(command) + " is not supported by backend");
+    }
     if (mySocket != nullptr) {
+        prepareRequest();
         mySocket->sendExact(myOutput);
         myInput.reset();
         check_resultState(myInput, command, ignoreCommandId);
@@ -342,7 +360,13 @@ TraCIAPI::processGet(int command, int expectedType, bool ignoreCommandId) {
 
 bool
 TraCIAPI::processSet(int command) {
+    if (myBackend != nullptr) {
+        prepareRequest();
+        myBackend->set(myOutput);
+        return true;
+    }
     if (mySocket != nullptr) {
+        prepareRequest();
         mySocket->sendExact(myOutput);
         myInput.reset();
         check_resultState(myInput, command);
@@ -445,6 +469,15 @@ TraCIAPI::readContextSubscription(int cmdId, tcpip::Storage& inMsg) {
 
 void
 TraCIAPI::simulationStep(double time) {
+    if (myBackend != nullptr) {
+        prepareRequest();
+        myBackend->simulationStep(time);
+        for (auto it : myDomains) {
+            it.second->clearSubscriptionResults();
+        }
+        myBackend->readSubscriptions(myDomains);
+        return;
+    }
     send_commandSimulationStep(time);
     tcpip::Storage inMsg;
     check_resultState(inMsg, libsumo::CMD_SIMSTEP);
@@ -477,6 +510,7 @@ TraCIAPI::load(const std::vector<std::string>& args) {
     content.writeUnsignedByte(libsumo::CMD_LOAD);
     content.writeUnsignedByte(libsumo::TYPE_STRINGLIST);
     content.writeStringList(args);
+    prepareRequest();
     mySocket->sendExact(content);
     tcpip::Storage inMsg;
     check_resultState(inMsg, libsumo::CMD_LOAD);
@@ -485,9 +519,14 @@ TraCIAPI::load(const std::vector<std::string>& args) {
 
 std::pair<int, std::string>
 TraCIAPI::getVersion() {
+    if (myBackend != nullptr) {
+        prepareRequest();
+        return myBackend->getVersion();
+    }
     tcpip::Storage content;
     content.writeUnsignedByte(2);
     content.writeUnsignedByte(libsumo::CMD_GETVERSION);
+    prepareRequest();
     mySocket->sendExact(content);
     tcpip::Storage inMsg;
     check_resultState(inMsg, libsumo::CMD_GETVERSION);
@@ -1509,6 +1548,10 @@ TraCIAPI::SimulationScope::convertRoad(double x, double y, bool isGeo, const std
 
 libsumo::TraCIPosition
 TraCIAPI::SimulationScope::convertGeo(double x, double y, bool fromGeo) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->convertGeo(x, y, fromGeo);
+    }
     const int posType = fromGeo ? libsumo::POSITION_2D : libsumo::POSITION_LON_LAT;
     libsumo::TraCIPosition result;
     tcpip::Storage content;
@@ -3456,6 +3499,10 @@ TraCIAPI::PersonScope::setColor(const std::string& personID, const libsumo::TraC
 
 int
 TraCIAPI::TraCIScopeWrapper::getUnsignedByte(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getInt(myCmdGetID, var, id, add);
+    }
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_UBYTE)) {
         return myParent.myInput.readUnsignedByte();
@@ -3466,6 +3513,10 @@ TraCIAPI::TraCIScopeWrapper::getUnsignedByte(int var, const std::string& id, tcp
 
 int
 TraCIAPI::TraCIScopeWrapper::getByte(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getInt(myCmdGetID, var, id, add);
+    }
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_BYTE)) {
         return myParent.myInput.readByte();
@@ -3477,6 +3528,10 @@ TraCIAPI::TraCIScopeWrapper::getByte(int var, const std::string& id, tcpip::Stor
 
 int
 TraCIAPI::TraCIScopeWrapper::getInt(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getInt(myCmdGetID, var, id, add);
+    }
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_INTEGER)) {
         return myParent.myInput.readInt();
@@ -3487,6 +3542,10 @@ TraCIAPI::TraCIScopeWrapper::getInt(int var, const std::string& id, tcpip::Stora
 
 double
 TraCIAPI::TraCIScopeWrapper::getDouble(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getDouble(myCmdGetID, var, id, add);
+    }
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_DOUBLE)) {
         return myParent.myInput.readDouble();
@@ -3497,6 +3556,10 @@ TraCIAPI::TraCIScopeWrapper::getDouble(int var, const std::string& id, tcpip::St
 
 libsumo::TraCIPositionVector
 TraCIAPI::TraCIScopeWrapper::getPolygon(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getPolygon(myCmdGetID, var, id, add);
+    }
     libsumo::TraCIPositionVector ret;
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_POLYGON)) {
@@ -3518,6 +3581,10 @@ TraCIAPI::TraCIScopeWrapper::getPolygon(int var, const std::string& id, tcpip::S
 
 libsumo::TraCIPosition
 TraCIAPI::TraCIScopeWrapper::getPos(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getPosition(myCmdGetID, var, id, add);
+    }
     libsumo::TraCIPosition p;
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::POSITION_2D)) {
@@ -3531,6 +3598,10 @@ TraCIAPI::TraCIScopeWrapper::getPos(int var, const std::string& id, tcpip::Stora
 
 libsumo::TraCIPosition
 TraCIAPI::TraCIScopeWrapper::getPos3D(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getPosition(myCmdGetID, var, id, add);
+    }
     libsumo::TraCIPosition p;
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::POSITION_3D)) {
@@ -3544,6 +3615,10 @@ TraCIAPI::TraCIScopeWrapper::getPos3D(int var, const std::string& id, tcpip::Sto
 
 std::string
 TraCIAPI::TraCIScopeWrapper::getString(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getString(myCmdGetID, var, id, add);
+    }
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_STRING)) {
         return myParent.myInput.readString();
@@ -3554,6 +3629,10 @@ TraCIAPI::TraCIScopeWrapper::getString(int var, const std::string& id, tcpip::St
 
 std::vector<std::string>
 TraCIAPI::TraCIScopeWrapper::getStringVector(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getStringVector(myCmdGetID, var, id, add);
+    }
     std::vector<std::string> r;
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_STRINGLIST)) {
@@ -3568,6 +3647,10 @@ TraCIAPI::TraCIScopeWrapper::getStringVector(int var, const std::string& id, tcp
 
 libsumo::TraCIColor
 TraCIAPI::TraCIScopeWrapper::getCol(int var, const std::string& id, tcpip::Storage* add) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        return myParent.myBackend->getColor(myCmdGetID, var, id, add);
+    }
     libsumo::TraCIColor c;
     myParent.createCommand(myCmdGetID, var, id, add);
     if (myParent.processGet(myCmdGetID, libsumo::TYPE_COLOR)) {
@@ -3728,6 +3811,11 @@ TraCIAPI::TraCIScopeWrapper::setStringVector(int var, const std::string& id, con
 
 void
 TraCIAPI::TraCIScopeWrapper::subscribe(const std::string& objID, const std::vector<int>& vars, double beginTime, double endTime) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        myParent.myBackend->subscribe(mySubscribeID, objID, vars, beginTime, endTime, myParent.myDomains[mySubscribeID + 0x10]->getModifiableSubscriptionResults());
+        return;
+    }
     myParent.send_commandSubscribeObjectVariable(mySubscribeID, objID, beginTime, endTime, vars);
     tcpip::Storage inMsg;
     myParent.check_resultState(inMsg, mySubscribeID);
@@ -3740,6 +3828,12 @@ TraCIAPI::TraCIScopeWrapper::subscribe(const std::string& objID, const std::vect
 
 void
 TraCIAPI::TraCIScopeWrapper::subscribeContext(const std::string& objID, int domain, double range, const std::vector<int>& vars, double beginTime, double endTime) const {
+    if (myParent.myBackend != nullptr) {
+        myParent.prepareRequest();
+        myParent.myBackend->subscribeContext(myContextSubscribeID, objID, domain, range, vars, beginTime, endTime,
+                                             myParent.myDomains[myContextSubscribeID + 0x60]->getModifiableContextSubscriptionResults(objID));
+        return;
+    }
     myParent.send_commandSubscribeObjectContext(myContextSubscribeID, objID, beginTime, endTime, domain, range, vars);
     tcpip::Storage inMsg;
     myParent.check_resultState(inMsg, myContextSubscribeID);
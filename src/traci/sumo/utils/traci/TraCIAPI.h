@@ -52,7 +52,7 @@ public:
     TraCIAPI();
 
     /// @brief Destructor
-    ~TraCIAPI();
+    virtual ~TraCIAPI();
 
     /// @name Connection handling
     /// @{
@@ -80,6 +80,44 @@ public:
     /// @brief return TraCI API and SUMO version
     std::pair<int, std::string> getVersion();
 
+    class TraCIScopeWrapper;
+
+    /** @class Backend
+     * @brief Serves requests without TraCI connection, e.g. by a SUMO instance within the client process (Artery extension)
+     *
+     * Getters and setters pass additional parameters in TraCI encoding because scope methods build them this way.
+     */
+    class Backend {
+    public:
+        virtual ~Backend() {}
+
+        virtual std::pair<int, std::string> getVersion() = 0;
+        virtual void close() = 0;
+
+        /// @brief performs a simulation step, subscription results are retrieved by readSubscriptions
+        virtual void simulationStep(double time) = 0;
+        /// @brief stores subscription results of latest simulation step in the domains' results
+        virtual void readSubscriptions(std::map<int, TraCIScopeWrapper*>& domains) = 0;
+
+        virtual int getInt(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual double getDouble(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual std::string getString(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual std::vector<std::string> getStringVector(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual libsumo::TraCIPosition getPosition(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual libsumo::TraCIPositionVector getPolygon(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual libsumo::TraCIColor getColor(int cmd, int var, const std::string& id, tcpip::Storage* add) = 0;
+        virtual libsumo::TraCIPosition convertGeo(double x, double y, bool fromGeo) = 0;
+
+        /// @brief processes a set command as written by createCommand
+        virtual void set(tcpip::Storage& command) = 0;
+
+        /// @brief subscribes variables (empty list cancels subscription) and stores initial values
+        virtual void subscribe(int cmd, const std::string& id, const std::vector<int>& vars, double beginTime, double endTime,
+                               libsumo::SubscriptionResults& into) = 0;
+        virtual void subscribeContext(int cmd, const std::string& id, int domain, double range, const std::vector<int>& vars,
+                                      double beginTime, double endTime, libsumo::SubscriptionResults& into) = 0;
+    };
+
     /** @class TraCIScopeWrapper
      * @brief An abstract interface for accessing type-dependent values
      *
@@ -932,6 +970,9 @@ protected:
     /// @brief Closes the connection
     void closeSocket();
 
+    /// @brief Hook invoked before any request is written to the socket (Artery extension)
+    virtual void prepareRequest() const {}
+
 protected:
     std::map<int, TraCIScopeWrapper*> myDomains;
     /// @brief The socket
@@ -940,4 +981,6 @@ protected:
     mutable tcpip::Storage myOutput;
     /// @brief The reusable input storage
     mutable tcpip::Storage myInput;
+    /// @brief Serves requests instead of socket if set (Artery extension)
+    Backend* myBackend = nullptr;
 };
@@ -0,0 +1,55 @@
+#!/usr/bin/env python3
+
+"""
+Measure scaling of parallel sensor measurements with the number of worker threads.
+
+The envmod scenario's parallel_measurement config is run for each thread count
+by overriding the environment model's measurementThreads parameter.
+Sensor detections are applied in a fixed order, i.e. all runs yield identical results.
+"""
+
+import os
+import sys
+import argparse
+import pathlib
+
+from pathlib import Path
+
+try:
+    from tools.benchmark_traci import measure
+except ModuleNotFoundError:
+    from benchmark_traci import measure
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-l', '--launch-conf', action='store', required=True, type=pathlib.Path)
+    parser.add_argument('-s', '--scenario', default=Path(__file__).parent.parent / 'scenarios' / 'envmod', type=pathlib.Path)
+    parser.add_argument('-c', '--config', default='parallel_measurement')
+    parser.add_argument('-j', '--threads', nargs='+', type=int, help='thread counts (default: powers of two up to all cores)')
+    parser.add_argument('-t', '--sim-time-limit', default=100.0, type=float, help='simulation time limit in seconds')
+    parser.add_argument('-r', '--repetitions', default=3, type=int)
+    args = parser.parse_args()
+
+    threads = args.threads
+    if not threads:
+        cores = os.cpu_count() or 1
+        threads = [1 << i for i in range(cores.bit_length()) if 1 << i <= cores]
+        if threads[-1] != cores:
+            threads.append(cores)
+
+    baseline = None
+    for count in threads:
+        override = [f'--*.environmentModel.measurementThreads={count}']
+        best = min(measure(args.launch_conf, args.scenario, args.config, args.sim_time_limit, args.repetitions, override))
+        if baseline is None:
+            baseline = best
+        print(f'{count:3d} threads: {best:8.3f} s wall time, speedup {baseline / best:5.2f}')
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        print('exited by user')
+        sys.exit(1)
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+
+"""
+Compare wall-clock time of Artery simulations using different TraCI backends,
+e.g. SUMO as separate process connected by TCP versus SUMO loaded in-process by libsumo.
+Per-step latency of the TraCI backend is taken from the step timing statistics recorded by traci.Core.
+"""
+
+import sys
+import time
+import argparse
+import pathlib
+import tempfile
+
+from pathlib import Path
+from typing import Dict, Iterable, List
+
+try:
+    from tools.run_artery import run_artery
+except ModuleNotFoundError:
+    from run_artery import run_artery
+
+
+def measure(launch_conf: Path, scenario: Path, config: str, sim_time_limit: float, repetitions: int,
+            extra_args: Iterable[str] = ()) -> List[float]:
+    opp_args = ['-u', 'Cmdenv', '-c', config, f'--sim-time-limit={sim_time_limit}s', *extra_args]
+    durations = []
+    for _ in range(repetitions):
+        start = time.perf_counter()
+        if run_artery(launch_conf, opp_args, scenario, capture_output=True) != 0:
+            raise RuntimeError(f'simulation of config {config} failed')
+        durations.append(time.perf_counter() - start)
+    return durations
+
+
+# traci.Core statistics covering a simulation step until its results are available
+STEP_PHASES = ['stepSendTime', 'stepWaitTime', 'stepResetTime', 'stepDecodeTime']
+
+
+def measure_step_latency(launch_conf: Path, scenario: Path, config: str, sim_time_limit: float,
+                         extra_args: Iterable[str] = ()) -> Dict[str, float]:
+    """
+    Run simulation once and return mean and max of each step phase in seconds, e.g. 'stepWaitTime:mean'
+    """
+    with tempfile.TemporaryDirectory() as tmpdir:
+        sca = Path(tmpdir) / 'steps.sca'
+        opp_args = ['-u', 'Cmdenv', '-c', config, f'--sim-time-limit={sim_time_limit}s',
+                    f'--output-scalar-file={sca}', *extra_args]
+        if run_artery(launch_conf, opp_args, scenario, capture_output=True) != 0:
+            raise RuntimeError(f'simulation of config {config} failed')
+
+        scalars = {}
+        for line in sca.read_text().splitlines():
+            fields = line.split()
+            if len(fields) >= 4 and fields[0] == 'scalar' and fields[2].split(':')[0] in STEP_PHASES:
+                scalars[fields[2]] = float(fields[3])
+        return scalars
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-l', '--launch-conf', action='store', required=True, type=pathlib.Path)
+    parser.add_argument('-s', '--scenario', default=Path(__file__).parent.parent / 'scenarios' / 'artery', type=pathlib.Path)
+    parser.add_argument('-c', '--configs', nargs='+', default=['inet', 'inet_libsumo'])
+    parser.add_argument('-t', '--sim-time-limit', default=60.0, type=float, help='simulation time limit in seconds')
+    parser.add_argument('--update-interval', default=1.0, type=float, help='TraCI update interval in seconds')
+    parser.add_argument('-r', '--repetitions', default=3, type=int)
+    args = parser.parse_args()
+
+    steps = args.sim_time_limit / args.update_interval
+    baseline = None
+    for config in args.configs:
+        best = min(measure(args.launch_conf, args.scenario, config, args.sim_time_limit, args.repetitions))
+        if baseline is None:
+            baseline = best
+        print(f'{config:>24}: {best:8.3f} s wall time, {1000.0 * best / steps:8.3f} ms per step, speedup {baseline / best:5.2f}')
+
+    # per-step latency: mean phases add up to mean latency, maximum is given for waiting only
+    for config in args.configs:
+        scalars = measure_step_latency(args.launch_conf, args.scenario, config, args.sim_time_limit)
+        latency = sum(scalars.get(f'{phase}:mean', 0.0) for phase in STEP_PHASES)
+        wait_max = scalars.get('stepWaitTime:max', 0.0)
+        print(f'{config:>24}: {1000.0 * latency:8.3f} ms mean TraCI latency per step, {1000.0 * wait_max:8.3f} ms max wait')
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        print('exited by user')
+        sys.exit(1)
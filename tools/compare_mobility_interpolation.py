@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+
+"""
+Compare accuracy and throughput of mobility interpolation modes with coarse SUMO step lengths.
+
+Accuracy: SUMO records a reference trajectory (FCD output) at a fine step length. Every n-th sample
+is treated as TraCI update of a coarse step length and positions in between are estimated like
+artery's MobilityBase does. Position and heading errors are reported against the reference samples.
+
+Throughput: optionally, Artery configurations are run and their wall-clock time is compared.
+"""
+
+import sys
+import math
+import argparse
+import pathlib
+import statistics
+import subprocess
+import tempfile
+import xml.etree.ElementTree as ET
+
+from collections import defaultdict
+from pathlib import Path
+from typing import Dict, List, NamedTuple, Optional
+
+try:
+    from tools.benchmark_traci import measure
+except ModuleNotFoundError:
+    from benchmark_traci import measure
+
+
+class Sample(NamedTuple):
+    time: float
+    x: float
+    y: float
+    heading: float  # radian, counter-clockwise from east
+    speed: float
+
+
+def record_trajectories(sumo: str, sumocfg: Path, step_length: float, end: float, fcd: Path) -> Dict[str, List[Sample]]:
+    cmd = [sumo,
+        '--configuration-file', str(sumocfg),
+        '--step-length', f'{step_length:g}',
+        '--end', f'{end:g}',
+        '--fcd-output', str(fcd),
+        '--no-step-log']
+    subprocess.run(cmd, check=True, capture_output=True)
+
+    trajectories = defaultdict(list)
+    for timestep in ET.parse(fcd).getroot().iter('timestep'):
+        time = float(timestep.get('time'))
+        for vehicle in timestep.iter('vehicle'):
+            # SUMO angles are clockwise from north
+            heading = math.radians(90.0 - float(vehicle.get('angle')))
+            trajectories[vehicle.get('id')].append(Sample(time,
+                float(vehicle.get('x')), float(vehicle.get('y')), heading, float(vehicle.get('speed'))))
+    return trajectories
+
+
+def interpolate(mode: str, latest: Sample, previous: Optional[Sample], time: float, horizon: float) -> Sample:
+    if mode == 'none' or time <= latest.time:
+        return latest
+
+    dt = min(time - latest.time, horizon)
+    turn_rate = 0.0
+    acceleration = 0.0
+    moving = dt
+    if mode == 'samples' and previous is not None:
+        span = latest.time - previous.time
+        turn_rate = math.remainder(latest.heading - previous.heading, 2.0 * math.pi) / span
+        acceleration = (latest.speed - previous.speed) / span
+        if acceleration < 0.0 and latest.speed + acceleration * dt < 0.0:
+            # vehicle halts within dt after v²/(2a) and stands still afterwards
+            moving = max(0.0, -latest.speed / acceleration)
+
+    distance = latest.speed * moving + 0.5 * acceleration * moving * moving
+    course = latest.heading + 0.5 * turn_rate * moving
+    return Sample(time,
+        latest.x + distance * math.cos(course),
+        latest.y + distance * math.sin(course),
+        latest.heading + turn_rate * moving,
+        max(0.0, latest.speed + acceleration * moving))
+
+
+def evaluate(trajectories: Dict[str, List[Sample]], mode: str, decimation: int, horizon: float):
+    position_errors = []
+    heading_errors = []
+    for samples in trajectories.values():
+        latest = previous = None
+        for index, sample in enumerate(samples):
+            if index % decimation == 0:
+                previous, latest = latest, sample
+                continue
+            estimate = interpolate(mode, latest, previous, sample.time, horizon)
+            position_errors.append(math.hypot(estimate.x - sample.x, estimate.y - sample.y))
+            heading_errors.append(abs(math.degrees(math.remainder(estimate.heading - sample.heading, 2.0 * math.pi))))
+    return position_errors, heading_errors
+
+
+def percentile(values: List[float], fraction: float) -> float:
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-c', '--sumocfg', required=True, type=pathlib.Path, help='SUMO configuration file')
+    parser.add_argument('--sumo', default='sumo', help='SUMO executable')
+    parser.add_argument('--reference-step', default=0.1, type=float, help='fine step length in seconds')
+    parser.add_argument('--steps', nargs='+', default=[0.5, 1.0], type=float, help='coarse step lengths in seconds')
+    parser.add_argument('--modes', nargs='+', default=['none', 'linear', 'samples'], choices=['none', 'linear', 'samples'])
+    parser.add_argument('--end', default=300.0, type=float, help='end of SUMO simulation in seconds')
+    parser.add_argument('-l', '--launch-conf', type=pathlib.Path, help='measure throughput of Artery configs using this launch configuration')
+    parser.add_argument('-s', '--scenario', default=Path(__file__).parent.parent / 'scenarios' / 'artery', type=pathlib.Path)
+    parser.add_argument('--configs', nargs='+', default=['inet', 'inet_interpolated_mobility'])
+    parser.add_argument('-t', '--sim-time-limit', default=60.0, type=float, help='simulation time limit of Artery runs in seconds')
+    parser.add_argument('-r', '--repetitions', default=3, type=int)
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        fcd = Path(tmpdir) / 'fcd.xml'
+        trajectories = record_trajectories(args.sumo, args.sumocfg.resolve(), args.reference_step, args.end, fcd)
+
+    print(f'{"step":>6} {"mode":>8} {"mean [m]":>9} {"p95 [m]":>9} {"max [m]":>9} {"p95 [deg]":>10}')
+    for step in args.steps:
+        decimation = round(step / args.reference_step)
+        if decimation < 2 or not math.isclose(decimation * args.reference_step, step):
+            raise ValueError(f'step length {step} is no multiple of reference step length {args.reference_step}')
+        for mode in args.modes:
+            position_errors, heading_errors = evaluate(trajectories, mode, decimation, step)
+            if not position_errors:
+                continue
+            print(f'{step:6g} {mode:>8} {statistics.mean(position_errors):9.3f} {percentile(position_errors, 0.95):9.3f} '
+                  f'{max(position_errors):9.3f} {percentile(heading_errors, 0.95):10.3f}')
+
+    if args.launch_conf:
+        baseline = None
+        for config in args.configs:
+            best = min(measure(args.launch_conf, args.scenario, config, args.sim_time_limit, args.repetitions))
+            if baseline is None:
+                baseline = best
+            print(f'{config:>32}: {best:8.3f} s wall time, speedup {baseline / best:5.2f}')
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        print('exited by user')
+        sys.exit(1)
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+
+"""
+Generate a SUMO state snapshot of a scenario for warm-starting Artery simulations.
+
+SUMO simulates the scenario once up to the given time and saves its state there.
+Artery loads this state by the launcher's loadState parameter, i.e. the traffic warm-up phase is skipped.
+Snapshots are cached: SUMO runs only if the snapshot is missing or older than the scenario's input files.
+"""
+
+import sys
+import argparse
+import pathlib
+import subprocess
+import xml.etree.ElementTree as ET
+
+from pathlib import Path
+from typing import List
+
+
+def input_files(sumocfg: Path) -> List[Path]:
+    files = [sumocfg]
+    inputs = ET.parse(sumocfg).getroot().find('input')
+    if inputs is not None:
+        for option in inputs:
+            for value in option.get('value', '').split(','):
+                if value.strip():
+                    files.append(sumocfg.parent / value.strip())
+    return files
+
+
+def default_output(sumocfg: Path, time: float, seed: int) -> Path:
+    stem = sumocfg.name.split('.')[0]
+    return sumocfg.parent / f'{stem}-{time:g}s-seed{seed}.state.xml.gz'
+
+
+def is_outdated(output: Path, sumocfg: Path) -> bool:
+    if not output.is_file():
+        return True
+    mtime = output.stat().st_mtime
+    return any(path.stat().st_mtime > mtime for path in input_files(sumocfg) if path.is_file())
+
+
+def generate_state(sumo: str, sumocfg: Path, time: float, seed: int, output: Path) -> int:
+    cmd = [sumo,
+        '--configuration-file', str(sumocfg),
+        '--seed', str(seed),
+        '--end', f'{time + 1.0:g}',
+        '--save-state.times', f'{time:g}',
+        '--save-state.files', str(output),
+        '--no-step-log']
+    return subprocess.run(cmd).returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('-c', '--sumocfg', required=True, type=pathlib.Path, help='SUMO configuration file')
+    parser.add_argument('-t', '--time', required=True, type=float, help='simulation time of snapshot in seconds')
+    parser.add_argument('-o', '--output', type=pathlib.Path, help='snapshot file (default: next to SUMO configuration)')
+    parser.add_argument('--seed', default=23423, type=int, help='SUMO seed (default matches launcher modules)')
+    parser.add_argument('--sumo', default='sumo', help='SUMO executable')
+    parser.add_argument('-f', '--force', action='store_true', help='generate snapshot even if cached one is up-to-date')
+    args = parser.parse_args()
+
+    sumocfg = args.sumocfg.resolve()
+    output = args.output.resolve() if args.output else default_output(sumocfg, args.time, args.seed)
+
+    if args.force or is_outdated(output, sumocfg):
+        returncode = generate_state(args.sumo, sumocfg, args.time, args.seed, output)
+        if returncode != 0:
+            output.unlink(missing_ok=True)
+            sys.exit(returncode)
+    print(output)
+
+
+if __name__ == '__main__':
+    try:
+        main()
+    except KeyboardInterrupt:
+        print('exited by user')
+        sys.exit(1)